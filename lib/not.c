@@ -499,7 +499,17 @@ not_record_destroy(not_record_t *record)
         {
             free(record->value);
         }
+
+        not_record_t *parent = record->parent;
         free(record);
+
+        if (parent)
+        {
+            if (not_record_link_decrease(parent) < 0)
+            {
+                return -1;
+            }
+        }
     }
 
     return 0;
@@ -13,10 +13,15 @@ typedef struct not_record
     uint8_t readonly : 1;
     uint8_t typed : 1;
     uint8_t null : 1;
-    uint8_t reserved : 4;
+    uint8_t undefined : 1;
+    uint8_t nan : 1;
+    uint8_t unpack : 1;
+    uint8_t immortal : 1;
     int64_t link;
     uint8_t kind;
     void *value;
+    /* owner of the buffer a reference record points into, kept alive by link */
+    struct not_record *parent;
 } not_record_t;
 
 typedef enum not_record_kind
@@ -91,6 +91,7 @@ static const char *const symbols[] = {
 	[NODE_KIND_CATCH] = "catch",
 	[NODE_KIND_TRY] = "try",
 	[NODE_KIND_RETURN] = "return",
+	[NODE_KIND_YIELD] = "yield",
 	[NODE_KIND_THROW] = "throw",
 
 	[NODE_KIND_VAR] = "var",
@@ -125,6 +126,18 @@ not_node_kind_as_string(not_node_t *node)
 	return symbols[node->kind];
 }
 
+/* binding plans of a call site are chained through their first field */
+static void
+not_node_plans_destroy(void *cache)
+{
+	while (cache != NULL)
+	{
+		void *next = *(void **)cache;
+		not_memory_free(cache);
+		cache = next;
+	}
+}
+
 void not_node_destroy(not_node_t *node)
 {
 	if (!node)
@@ -206,6 +219,14 @@ void not_node_destroy(not_node_t *node)
 			next = item->next;
 			not_node_destroy(item);
 		}
+		if (class->members)
+		{
+			not_memory_free(class->members);
+		}
+		if (class->prototype)
+		{
+			not_memory_free(class->prototype);
+		}
 		not_memory_free(class);
 	}
 	else if (node->kind == NODE_KIND_FUN)
@@ -328,6 +349,10 @@ void not_node_destroy(not_node_t *node)
 		not_node_destroy(basic->type);
 		not_node_destroy(basic->value);
 		not_node_destroy(basic->notes);
+		if (basic->check)
+		{
+			not_memory_free(basic->check);
+		}
 		not_memory_free(basic);
 	}
 	else if (node->kind == NODE_KIND_PARAMETER)
@@ -336,6 +361,10 @@ void not_node_destroy(not_node_t *node)
 		not_node_destroy(basic->key);
 		not_node_destroy(basic->type);
 		not_node_destroy(basic->value);
+		if (basic->check)
+		{
+			not_memory_free(basic->check);
+		}
 		not_memory_free(basic);
 	}
 	else if (node->kind == NODE_KIND_ARGUMENT)
@@ -401,6 +430,10 @@ void not_node_destroy(not_node_t *node)
 		not_node_destroy(var1->key);
 		not_node_destroy(var1->type);
 		not_node_destroy(var1->value);
+		if (var1->check)
+		{
+			not_memory_free(var1->check);
+		}
 		not_memory_free(var1);
 	}
 	else if (node->kind == NODE_KIND_SET)
@@ -445,6 +478,12 @@ void not_node_destroy(not_node_t *node)
 		not_node_destroy(basic->right);
 		not_memory_free(basic);
 	}
+	else if (node->kind == NODE_KIND_YIELD)
+	{
+		not_node_unary_t *basic = (not_node_unary_t *)node->value;
+		not_node_destroy(basic->right);
+		not_memory_free(basic);
+	}
 	else if (node->kind == NODE_KIND_CONDITIONAL)
 	{
 		not_node_triple_t *basic = (not_node_triple_t *)node->value;
@@ -731,6 +770,7 @@ void not_node_destroy(not_node_t *node)
 		not_node_carrier_t *basic = (not_node_carrier_t *)node->value;
 		not_node_destroy(basic->base);
 		not_node_destroy(basic->data);
+		not_node_plans_destroy(basic->cache);
 		not_memory_free(basic);
 	}
 	else if (node->kind == NODE_KIND_ARRAY)
@@ -738,20 +778,29 @@ void not_node_destroy(not_node_t *node)
 		not_node_carrier_t *basic = (not_node_carrier_t *)node->value;
 		not_node_destroy(basic->base);
 		not_node_destroy(basic->data);
+		not_node_plans_destroy(basic->cache);
 		not_memory_free(basic);
 	}
 	else if (node->kind == NODE_KIND_PSEUDONYM)
 	{
-		not_node_carrier_t *basic = (not_node_carrier_t *)node->value;
+		not_node_pseudonym_t *basic = (not_node_pseudonym_t *)node->value;
 		not_node_destroy(basic->base);
 		not_node_destroy(basic->data);
+		if (basic->cache)
+		{
+			not_memory_free(basic->cache);
+		}
 		not_memory_free(basic);
 	}
 	else if (node->kind == NODE_KIND_ATTRIBUTE)
 	{
-		not_node_binary_t *basic = (not_node_binary_t *)node->value;
+		not_node_attribute_t *basic = (not_node_attribute_t *)node->value;
 		not_node_destroy(basic->left);
 		not_node_destroy(basic->right);
+		if (basic->cache)
+		{
+			not_memory_free(basic->cache);
+		}
 		not_memory_free(basic);
 	}
 	else if (node->kind == NODE_KIND_ID)
@@ -1126,7 +1175,7 @@ not_node_make_object(not_node_t *node, not_node_t *items)
 not_node_t *
 not_node_make_pseudonym(not_node_t *node, not_node_t *base, not_node_t *concepts)
 {
-	not_node_carrier_t *basic = (not_node_carrier_t *)not_memory_calloc(1, sizeof(not_node_carrier_t));
+	not_node_pseudonym_t *basic = (not_node_pseudonym_t *)not_memory_calloc(1, sizeof(not_node_pseudonym_t));
 	if (!basic)
 	{
 		not_error_no_memory();
@@ -1135,6 +1184,7 @@ not_node_make_pseudonym(not_node_t *node, not_node_t *base, not_node_t *concepts
 
 	basic->base = base;
 	basic->data = concepts;
+	basic->cache = NULL;
 
 	not_node_update(node, NODE_KIND_PSEUDONYM, basic);
 	return node;
@@ -1200,6 +1250,7 @@ not_node_make_call(not_node_t *node, not_node_t *base, not_node_t *arguments)
 
 	basic->base = base;
 	basic->data = arguments;
+	basic->cache = NULL;
 
 	not_node_update(node, NODE_KIND_CALL, basic);
 	return node;
@@ -1217,6 +1268,7 @@ not_node_make_array(not_node_t *node, not_node_t *base, not_node_t *arguments)
 
 	basic->base = base;
 	basic->data = arguments;
+	basic->cache = NULL;
 
 	not_node_update(node, NODE_KIND_ARRAY, basic);
 	return node;
@@ -1225,7 +1277,7 @@ not_node_make_array(not_node_t *node, not_node_t *base, not_node_t *arguments)
 not_node_t *
 not_node_make_attribute(not_node_t *node, not_node_t *left, not_node_t *right)
 {
-	not_node_binary_t *basic = (not_node_binary_t *)not_memory_calloc(1, sizeof(not_node_binary_t));
+	not_node_attribute_t *basic = (not_node_attribute_t *)not_memory_calloc(1, sizeof(not_node_attribute_t));
 	if (!basic)
 	{
 		not_error_no_memory();
@@ -1234,6 +1286,7 @@ not_node_make_attribute(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->cache = NULL;
 
 	not_node_update(node, NODE_KIND_ATTRIBUTE, basic);
 	return node;
@@ -1315,6 +1368,7 @@ not_node_make_pow(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_POW, basic);
 	return node;
@@ -1332,6 +1386,7 @@ not_node_make_epi(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_EPI, basic);
 	return node;
@@ -1349,6 +1404,7 @@ not_node_make_mul(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_MUL, basic);
 	return node;
@@ -1366,6 +1422,7 @@ not_node_make_div(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_DIV, basic);
 	return node;
@@ -1383,6 +1440,7 @@ not_node_make_mod(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_MOD, basic);
 	return node;
@@ -1400,6 +1458,7 @@ not_node_make_plus(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_PLUS, basic);
 	return node;
@@ -1417,6 +1476,7 @@ not_node_make_minus(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_MINUS, basic);
 	return node;
@@ -1434,6 +1494,7 @@ not_node_make_shl(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_SHL, basic);
 	return node;
@@ -1451,6 +1512,7 @@ not_node_make_shr(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_SHR, basic);
 	return node;
@@ -1468,6 +1530,7 @@ not_node_make_lt(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_LT, basic);
 	return node;
@@ -1485,6 +1548,7 @@ not_node_make_le(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_LE, basic);
 	return node;
@@ -1502,6 +1566,7 @@ not_node_make_gt(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_GT, basic);
 	return node;
@@ -1519,6 +1584,7 @@ not_node_make_ge(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_GE, basic);
 	return node;
@@ -1536,6 +1602,7 @@ not_node_make_eq(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_EQ, basic);
 	return node;
@@ -1553,6 +1620,7 @@ not_node_make_neq(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_NEQ, basic);
 	return node;
@@ -1570,6 +1638,7 @@ not_node_make_and(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_AND, basic);
 	return node;
@@ -1587,6 +1656,7 @@ not_node_make_xor(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_XOR, basic);
 	return node;
@@ -1604,6 +1674,7 @@ not_node_make_or(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_OR, basic);
 	return node;
@@ -1621,6 +1692,7 @@ not_node_make_land(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_LAND, basic);
 	return node;
@@ -1638,6 +1710,7 @@ not_node_make_lor(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_LOR, basic);
 	return node;
@@ -1655,6 +1728,7 @@ not_node_make_instanceof(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_INSTANCEOF, basic);
 	return node;
@@ -1690,6 +1764,7 @@ not_node_make_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_ASSIGN, basic);
 	return node;
@@ -1707,6 +1782,7 @@ not_node_make_add_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_ADD_ASSIGN, basic);
 	return node;
@@ -1724,6 +1800,7 @@ not_node_make_sub_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_SUB_ASSIGN, basic);
 	return node;
@@ -1741,6 +1818,7 @@ not_node_make_div_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_DIV_ASSIGN, basic);
 	return node;
@@ -1758,6 +1836,7 @@ not_node_make_epi_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_EPI_ASSIGN, basic);
 	return node;
@@ -1775,6 +1854,7 @@ not_node_make_mul_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_MUL_ASSIGN, basic);
 	return node;
@@ -1792,6 +1872,7 @@ not_node_make_mod_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_MOD_ASSIGN, basic);
 	return node;
@@ -1809,6 +1890,7 @@ not_node_make_pow_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_POW_ASSIGN, basic);
 	return node;
@@ -1826,6 +1908,7 @@ not_node_make_and_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_AND_ASSIGN, basic);
 	return node;
@@ -1843,6 +1926,7 @@ not_node_make_or_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_OR_ASSIGN, basic);
 	return node;
@@ -1860,6 +1944,7 @@ not_node_make_shl_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_SHL_ASSIGN, basic);
 	return node;
@@ -1877,6 +1962,7 @@ not_node_make_shr_assign(not_node_t *node, not_node_t *left, not_node_t *right)
 
 	basic->left = left;
 	basic->right = right;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_SHR_ASSIGN, basic);
 	return node;
@@ -1946,6 +2032,22 @@ not_node_make_return(not_node_t *node, not_node_t *expression)
 	return node;
 }
 
+not_node_t *
+not_node_make_yield(not_node_t *node, not_node_t *expression)
+{
+	not_node_unary_t *basic = (not_node_unary_t *)not_memory_calloc(1, sizeof(not_node_unary_t));
+	if (!basic)
+	{
+		not_error_no_memory();
+		return NOT_PTR_ERROR;
+	}
+
+	basic->right = expression;
+
+	not_node_update(node, NODE_KIND_YIELD, basic);
+	return node;
+}
+
 not_node_t *
 not_node_make_if(not_node_t *node, not_node_t *condition, not_node_t *then_body, not_node_t *else_body)
 {
@@ -1979,6 +2081,7 @@ not_node_make_for(not_node_t *node, not_node_t *key, not_node_t *initializer, no
 	basic->condition = condition;
 	basic->incrementor = incrementor;
 	basic->body = body;
+	basic->counted = 0;
 
 	not_node_update(node, NODE_KIND_FOR, basic);
 	return node;
@@ -2053,6 +2156,8 @@ not_node_make_var(not_node_t *node, uint64_t flag, not_node_t *key, not_node_t *
 	basic->key = key;
 	basic->type = type;
 	basic->value = value;
+	basic->check = NULL;
+	basic->typed = NODE_TYPED_NONE;
 
 	not_node_update(node, NODE_KIND_VAR, basic);
 	return node;
@@ -2105,6 +2210,7 @@ not_node_make_parameter(not_node_t *node, uint64_t flag, not_node_t *key, not_no
 	basic->key = key;
 	basic->type = type;
 	basic->value = value;
+	basic->check = NULL;
 
 	not_node_update(node, NODE_KIND_PARAMETER, basic);
 	return node;
@@ -2250,6 +2356,8 @@ not_node_make_property(not_node_t *node, not_node_t *notes, uint64_t flag, not_n
 	basic->key = key;
 	basic->type = type;
 	basic->value = value;
+	basic->check = NULL;
+	basic->written = 0;
 
 	not_node_update(node, NODE_KIND_PROPERTY, basic);
 	return node;
@@ -2356,6 +2464,8 @@ not_node_make_class(not_node_t *node, not_node_t *notes, uint64_t flag, not_node
 	basic->generics = generics;
 	basic->heritages = heritages;
 	basic->block = block;
+	basic->members = NULL;
+	basic->prototype = NULL;
 
 	not_node_update(node, NODE_KIND_CLASS, basic);
 	return node;
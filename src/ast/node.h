@@ -106,6 +106,7 @@ typedef enum not_node_kind
 	NODE_KIND_CATCH,
 	NODE_KIND_TRY,
 	NODE_KIND_RETURN,
+	NODE_KIND_YIELD,
 	NODE_KIND_THROW,
 
 	NODE_KIND_VAR,
@@ -149,6 +150,8 @@ typedef struct not_node_carrier
 {
 	not_node_t *base;
 	not_node_t *data;
+	/* argument binding plans of a call site */
+	void *cache;
 } not_node_carrier_t;
 
 typedef struct not_node_unary
@@ -156,12 +159,36 @@ typedef struct not_node_unary
 	not_node_t *right;
 } not_node_unary_t;
 
+typedef enum not_node_typed
+{
+	NODE_TYPED_NONE = 0,
+	NODE_TYPED_INT,
+	NODE_TYPED_FLOAT,
+	NODE_TYPED_STRING
+} not_node_typed_t;
+
 typedef struct not_node_binary
 {
 	not_node_t *left;
 	not_node_t *right;
+	/* operand kind proven by the typing pass, a hint checked at runtime */
+	int32_t typed;
 } not_node_binary_t;
 
+typedef struct not_node_attribute
+{
+	not_node_t *left;
+	not_node_t *right;
+	void *cache;
+} not_node_attribute_t;
+
+typedef struct not_node_pseudonym
+{
+	not_node_t *base;
+	not_node_t *data;
+	void *cache;
+} not_node_pseudonym_t;
+
 typedef struct not_node_triple
 {
 	not_node_t *base;
@@ -176,6 +203,9 @@ typedef struct not_node_if
 	not_node_t *else_body;
 } not_node_if_t;
 
+/* names a counted loop bound may read, each is guarded at runtime */
+#define NODE_FOR_COUNTED_NAMES 4
+
 typedef struct not_node_for
 {
 	not_node_t *key;
@@ -183,6 +213,8 @@ typedef struct not_node_for
 	not_node_t *condition;
 	not_node_t *incrementor;
 	not_node_t *body;
+	/* int counter stepped by a literal against a bound, set by the typing pass */
+	int32_t counted;
 } not_node_for_t;
 
 typedef struct not_node_forin
@@ -213,6 +245,8 @@ typedef struct not_node_var
 	not_node_t *key;
 	not_node_t *type;
 	not_node_t *value;
+	void *check;
+	int32_t typed;
 } not_node_var_t;
 
 typedef struct not_node_parameter
@@ -221,6 +255,7 @@ typedef struct not_node_parameter
 	not_node_t *key;
 	not_node_t *type;
 	not_node_t *value;
+	void *check;
 } not_node_parameter_t;
 
 typedef struct not_node_field
@@ -260,6 +295,7 @@ typedef struct not_node_lambda
 	not_node_t *parameters;
 	not_node_t *body;
 	not_node_t *result;
+	uint64_t flag;
 } not_node_lambda_t;
 
 typedef struct not_node_fun
@@ -280,6 +316,9 @@ typedef struct not_node_property
 	not_node_t *key;
 	not_node_t *type;
 	not_node_t *value;
+	void *check;
+	/* assigned or passed where a reference could bind it, reads are not folded */
+	int32_t written;
 } not_node_property_t;
 
 typedef struct not_node_entity
@@ -304,6 +343,8 @@ typedef struct not_node_class
 	not_node_t *heritages;
 	not_node_t *generics;
 	not_node_t *block;
+	void *members;
+	void *prototype;
 } not_node_class_t;
 
 typedef struct not_node_note
@@ -547,6 +588,9 @@ not_node_make_try(not_node_t *node, not_node_t *body, not_node_t *catchs);
 not_node_t *
 not_node_make_return(not_node_t *node, not_node_t *expr);
 
+not_node_t *
+not_node_make_yield(not_node_t *node, not_node_t *expr);
+
 not_node_t *
 not_node_make_var(not_node_t *node, uint64_t flag, not_node_t *name, not_node_t *type, not_node_t *value);
 
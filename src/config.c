@@ -232,6 +232,7 @@ not_config_init()
 {
     not_config_t *config = not_config_get();
     config->expection = 0;
+    config->dump_types = 0;
 
     FILE *file = fopen(CONFIG_PATH, "r");
     if (!file)
@@ -337,4 +338,17 @@ void not_config_expection_set(int32_t expection)
 {
     not_config_t *config = not_config_get();
     config->expection = expection;
+}
+
+int32_t
+not_config_dump_types_is_enable()
+{
+    not_config_t *config = not_config_get();
+    return config->dump_types != 0;
+}
+
+void not_config_dump_types_set(int32_t dump_types)
+{
+    not_config_t *config = not_config_get();
+    config->dump_types = dump_types;
 }
\ No newline at end of file
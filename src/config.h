@@ -13,6 +13,7 @@ typedef struct not_config
     char input_file[MAX_PATH];
     char library_path[MAX_PATH];
     int32_t expection;
+    int32_t dump_types;
 } not_config_t;
 
 int32_t
@@ -29,6 +30,11 @@ not_config_expection_is_enable();
 
 void not_config_expection_set(int32_t expection);
 
+int32_t
+not_config_dump_types_is_enable();
+
+void not_config_dump_types_set(int32_t dump_types);
+
 not_config_t *
 not_config_get();
 
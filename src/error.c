@@ -53,217 +53,398 @@ void not_error_fatal_format(const char *format, ...)
     }
 }
 
-void not_error_no_memory()
+/*
+ * Errors are kept as a code, a position and a message until something
+ * needs them as a value; most of them are caught or printed only once.
+ */
+static int32_t
+not_error_raise_arg(int32_t code, not_position_t *position, const char *format, va_list arg)
 {
-    if (not_config_expection_is_enable())
+    not_thread_t *t = not_thread_get_current();
+    if ((!t) || (!t->interpreter))
     {
-        not_config_expection_set(0);
+        return -1;
+    }
 
-        not_record_t *code = not_record_make_int_from_si(ERR_LEXER_TYPE);
-        not_record_t *message = not_record_make_string("Out of memory");
-        if ((code == NOT_PTR_ERROR) || (message == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
+    not_interpreter_t *interpreter = t->interpreter;
+    not_error_t *error = interpreter->error;
 
-        not_record_object_t *object_code = not_record_make_object("code", code, NULL);
-        if (object_code == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_message = not_record_make_object("message", message, object_code);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
+    if (interpreter->expection)
+    {
+        not_record_t *expection = interpreter->expection;
+        interpreter->expection = NULL;
+        not_record_link_decrease(expection);
+    }
 
-        not_record_t *record_error = not_record_create(RECORD_KIND_OBJECT, object_message);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            not_record_object_destroy(object_message);
-            goto region_fatal;
-        }
+    error->code = code;
+    error->positioned = 0;
+    error->message[0] = '\0';
 
-        not_thread_t *t = not_thread_get_current();
-        if (!t)
-        {
-            goto region_fatal;
-        }
+    if (position)
+    {
+        error->positioned = 1;
+        error->line = position->line;
+        error->column = position->column;
+        error->offset = position->offset;
+        snprintf(error->path, sizeof(error->path), "%s", position->path);
+    }
 
-        if (NOT_PTR_ERROR == not_queue_right_push(t->interpreter->expections, record_error))
-        {
-            goto region_fatal;
-        }
+    if (format)
+    {
+        vsnprintf(error->message, sizeof(error->message), format, arg);
+    }
 
-        not_config_expection_set(1);
-        return;
+    error->depth = 0;
+    for (not_interpreter_call_t *call = interpreter->calls; (call != NULL) && (error->depth < NOT_ERROR_MAX_TRACE); call = call->previous)
+    {
+        error->callees[error->depth] = call->callee;
+        error->sites[error->depth] = call->site;
+        error->depth += 1;
     }
 
-region_fatal:
-    not_error_fatal_format("Out of memory");
+    error->pending = 1;
+    return 0;
 }
 
-void not_error_system(const char *format, ...)
+static int32_t
+not_error_raise(int32_t code, not_position_t *position, const char *format, ...)
 {
-    if (not_config_expection_is_enable())
+    va_list arg;
+    va_start(arg, format);
+    int32_t r1 = not_error_raise_arg(code, position, format, arg);
+    va_end(arg);
+    return r1;
+}
+
+static char *
+not_error_trace_name(not_node_t *callee)
+{
+    not_node_t *key = NULL;
+    if (callee->kind == NODE_KIND_FUN)
     {
-        not_config_expection_set(0);
+        key = ((not_node_fun_t *)callee->value)->key;
+    }
+    else if (callee->kind == NODE_KIND_LAMBDA)
+    {
+        key = ((not_node_lambda_t *)callee->value)->key;
 
-        char message_str[4096];
-        memset(message_str, 0, 4096);
-        if (format)
+        /* an anonymous lambda goes by the variable it initializes */
+        not_node_t *parent = callee->parent;
+        if ((key == NULL) && (parent != NULL) && (parent->kind == NODE_KIND_VAR))
         {
-            va_list arg;
-            va_start(arg, format);
-            vsprintf(message_str, format, arg);
-            va_end(arg);
+            not_node_var_t *var1 = (not_node_var_t *)parent->value;
+            if ((var1->key != NULL) && (var1->key->kind == NODE_KIND_ID) && (var1->value == callee))
+            {
+                key = var1->key;
+            }
         }
+    }
+    else if (callee->kind == NODE_KIND_CLASS)
+    {
+        key = ((not_node_class_t *)callee->value)->key;
+    }
 
-        not_record_t *code = not_record_make_int_from_si(ERR_LEXER_TYPE);
-        not_record_t *message = not_record_make_string(message_str);
-        if ((code == NOT_PTR_ERROR) || (message == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
+    if (key == NULL)
+    {
+        return "lambda";
+    }
 
-        not_record_object_t *object_code = not_record_make_object("code", code, NULL);
-        if (object_code == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_message = not_record_make_object("message", message, object_code);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
+    not_node_basic_t *basic = (not_node_basic_t *)key->value;
+    return basic->value;
+}
+
+static not_record_t *
+not_error_trace_record(not_node_t *callee, not_node_t *site)
+{
+    not_position_t position = site->position;
+
+    not_record_t *line = not_record_make_int_from_ui(position.line);
+    not_record_t *column = not_record_make_int_from_ui(position.column);
+    not_record_t *path = not_record_make_string(position.path);
+    not_record_t *name = not_record_make_string(not_error_trace_name(callee));
+    if ((line == NOT_PTR_ERROR) || (column == NOT_PTR_ERROR) || (path == NOT_PTR_ERROR) || (name == NOT_PTR_ERROR))
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    not_record_object_t *object_line = not_record_make_object("line", line, NULL);
+    if (object_line == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+    not_record_object_t *object_column = not_record_make_object("column", column, object_line);
+    if (object_column == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+    not_record_object_t *object_path = not_record_make_object("path", path, object_column);
+    if (object_path == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+    not_record_object_t *object_name = not_record_make_object("name", name, object_path);
+    if (object_name == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    not_record_t *record_trace = not_record_create(RECORD_KIND_OBJECT, object_name);
+    if (record_trace == NOT_PTR_ERROR)
+    {
+        not_record_object_destroy(object_name);
+        return NOT_PTR_ERROR;
+    }
 
-        not_record_t *record_error = not_record_create(RECORD_KIND_OBJECT, object_message);
-        if (object_message == NOT_PTR_ERROR)
+    return record_trace;
+}
+
+static not_record_t *
+not_error_record(not_error_t *error)
+{
+    not_record_object_t *object_next = NULL;
+
+    if (error->depth > 0)
+    {
+        /* innermost call first */
+        not_record_tuple_t *tuple = NULL;
+        for (uint64_t i = error->depth; i > 0; i--)
         {
-            not_record_object_destroy(object_message);
-            goto region_fatal;
+            not_record_t *record_trace = not_error_trace_record(error->callees[i - 1], error->sites[i - 1]);
+            if (record_trace == NOT_PTR_ERROR)
+            {
+                return NOT_PTR_ERROR;
+            }
+
+            not_record_tuple_t *tuple_next = not_record_make_tuple(record_trace, tuple);
+            if (tuple_next == NOT_PTR_ERROR)
+            {
+                return NOT_PTR_ERROR;
+            }
+            tuple = tuple_next;
         }
 
-        not_thread_t *t = not_thread_get_current();
-        if (!t)
+        not_record_t *record_tuple = not_record_create(RECORD_KIND_TUPLE, tuple);
+        if (record_tuple == NOT_PTR_ERROR)
         {
-            goto region_fatal;
+            return NOT_PTR_ERROR;
         }
 
-        if (NOT_PTR_ERROR == not_queue_right_push(t->interpreter->expections, record_error))
+        object_next = not_record_make_object("trace", record_tuple, NULL);
+        if (object_next == NOT_PTR_ERROR)
         {
-            goto region_fatal;
+            return NOT_PTR_ERROR;
         }
-
-        not_config_expection_set(1);
-        return;
     }
 
-region_fatal:
-    va_list arg;
-    va_start(arg, format);
-    not_error_fatal_format_arg(format, arg);
-    va_end(arg);
-}
-
-void not_error_lexer_by_position(not_position_t position, const char *format, ...)
-{
-    if (not_config_expection_is_enable())
+    if (error->positioned)
     {
-        not_config_expection_set(0);
-
-        not_record_t *line = not_record_make_int_from_ui(position.line);
-        not_record_t *column = not_record_make_int_from_ui(position.column);
-        not_record_t *offset = not_record_make_int_from_ui(position.offset);
-        not_record_t *path = not_record_make_string(position.path);
+        not_record_t *line = not_record_make_int_from_ui(error->line);
+        not_record_t *column = not_record_make_int_from_ui(error->column);
+        not_record_t *offset = not_record_make_int_from_ui(error->offset);
+        not_record_t *path = not_record_make_string(error->path);
         if ((line == NOT_PTR_ERROR) || (column == NOT_PTR_ERROR) || (offset == NOT_PTR_ERROR) || (path == NOT_PTR_ERROR))
         {
-            goto region_fatal;
+            return NOT_PTR_ERROR;
         }
 
         not_record_object_t *object_line = not_record_make_object("line", line, NULL);
         if (object_line == NOT_PTR_ERROR)
         {
-            goto region_fatal;
+            return NOT_PTR_ERROR;
         }
         not_record_object_t *object_column = not_record_make_object("column", column, object_line);
         if (object_column == NOT_PTR_ERROR)
         {
-            goto region_fatal;
+            return NOT_PTR_ERROR;
         }
         not_record_object_t *object_offset = not_record_make_object("offset", offset, object_column);
         if (object_offset == NOT_PTR_ERROR)
         {
-            goto region_fatal;
+            return NOT_PTR_ERROR;
         }
         not_record_object_t *object_path = not_record_make_object("path", path, object_offset);
         if (object_path == NOT_PTR_ERROR)
         {
-            goto region_fatal;
+            return NOT_PTR_ERROR;
         }
 
         not_record_t *record_position = not_record_create(RECORD_KIND_OBJECT, object_path);
         if (record_position == NOT_PTR_ERROR)
         {
-            goto region_fatal;
+            return NOT_PTR_ERROR;
         }
 
-        char message_str[4096];
-        memset(message_str, 0, 4096);
-        if (format)
+        object_next = not_record_make_object("position", record_position, object_next);
+        if (object_next == NOT_PTR_ERROR)
         {
-            va_list arg;
-            va_start(arg, format);
-            vsprintf(message_str, format, arg);
-            va_end(arg);
+            return NOT_PTR_ERROR;
         }
+    }
 
-        not_record_t *code = not_record_make_int_from_si(ERR_LEXER_TYPE);
-        not_record_t *message = not_record_make_string(message_str);
-        if ((code == NOT_PTR_ERROR) || (message == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
+    not_record_t *code = not_record_make_int_from_si(error->code);
+    not_record_t *message = not_record_make_string(error->message);
+    if ((code == NOT_PTR_ERROR) || (message == NOT_PTR_ERROR))
+    {
+        return NOT_PTR_ERROR;
+    }
 
-        not_record_object_t *object_position = not_record_make_object("position", record_position, NULL);
-        if (object_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_code = not_record_make_object("code", code, object_position);
-        if (object_code == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_message = not_record_make_object("message", message, object_code);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
+    not_record_object_t *object_code = not_record_make_object("code", code, object_next);
+    if (object_code == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+    not_record_object_t *object_message = not_record_make_object("message", message, object_code);
+    if (object_message == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    not_record_t *record_error = not_record_create(RECORD_KIND_OBJECT, object_message);
+    if (record_error == NOT_PTR_ERROR)
+    {
+        not_record_object_destroy(object_message);
+        return NOT_PTR_ERROR;
+    }
+
+    return record_error;
+}
+
+not_error_t *
+not_error_create()
+{
+    not_error_t *error = (not_error_t *)not_memory_calloc(1, sizeof(not_error_t));
+    if (!error)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    return error;
+}
+
+void not_error_destroy(not_error_t *error)
+{
+    not_memory_free(error);
+}
+
+void not_error_throw(not_record_t *value)
+{
+    not_thread_t *t = not_thread_get_current();
+    not_interpreter_t *interpreter = t->interpreter;
+
+    not_error_clear();
+
+    interpreter->expection = value;
+}
+
+int32_t
+not_error_is_pending()
+{
+    not_thread_t *t = not_thread_get_current();
+    not_interpreter_t *interpreter = t->interpreter;
+    not_error_t *error = interpreter->error;
+
+    return (interpreter->expection != NULL) || (error->pending != 0);
+}
+
+void not_error_clear()
+{
+    not_thread_t *t = not_thread_get_current();
+    not_interpreter_t *interpreter = t->interpreter;
+    not_error_t *error = interpreter->error;
+
+    error->pending = 0;
+
+    if (interpreter->expection)
+    {
+        not_record_t *expection = interpreter->expection;
+        interpreter->expection = NULL;
+        not_record_link_decrease(expection);
+    }
+}
+
+not_record_t *
+not_error_take()
+{
+    not_thread_t *t = not_thread_get_current();
+    not_interpreter_t *interpreter = t->interpreter;
+    not_error_t *error = interpreter->error;
+
+    if (interpreter->expection)
+    {
+        not_record_t *expection = interpreter->expection;
+        interpreter->expection = NULL;
+        return expection;
+    }
+
+    if (error->pending == 0)
+    {
+        return NULL;
+    }
+
+    error->pending = 0;
 
-        not_record_t *record_error = not_record_create(RECORD_KIND_OBJECT, object_message);
-        if (object_message == NOT_PTR_ERROR)
+    int32_t enable = not_config_expection_is_enable();
+    not_config_expection_set(0);
+    not_record_t *record_error = not_error_record(error);
+    not_config_expection_set(enable);
+
+    if (record_error == NOT_PTR_ERROR)
+    {
+        not_error_fatal_format("Out of memory");
+    }
+
+    return record_error;
+}
+
+void not_error_no_memory()
+{
+    if (not_config_expection_is_enable())
+    {
+        if (not_error_raise(ERR_LEXER_TYPE, NULL, "Out of memory") == 0)
         {
-            not_record_object_destroy(object_message);
-            goto region_fatal;
+            return;
         }
+    }
+
+    not_error_fatal_format("Out of memory");
+}
+
+void not_error_system(const char *format, ...)
+{
+    if (not_config_expection_is_enable())
+    {
+        va_list arg;
+        va_start(arg, format);
+        int32_t r1 = not_error_raise_arg(ERR_LEXER_TYPE, NULL, format, arg);
+        va_end(arg);
 
-        not_thread_t *t = not_thread_get_current();
-        if (!t)
+        if (r1 == 0)
         {
-            goto region_fatal;
+            return;
         }
+    }
 
-        if (NOT_PTR_ERROR == not_queue_right_push(t->interpreter->expections, record_error))
+    va_list arg;
+    va_start(arg, format);
+    not_error_fatal_format_arg(format, arg);
+    va_end(arg);
+}
+
+void not_error_lexer_by_position(not_position_t position, const char *format, ...)
+{
+    if (not_config_expection_is_enable())
+    {
+        va_list arg;
+        va_start(arg, format);
+        int32_t r1 = not_error_raise_arg(ERR_LEXER_TYPE, &position, format, arg);
+        va_end(arg);
+
+        if (r1 == 0)
         {
-            goto region_fatal;
+            return;
         }
-
-        not_config_expection_set(1);
-        return;
     }
 
-region_fatal:
     fputs("Traceback:\n", stderr);
 
     char base_path[MAX_PATH];
@@ -404,100 +585,17 @@ void not_error_syntax_by_position(not_position_t position, const char *format, .
 {
     if (not_config_expection_is_enable())
     {
-        not_config_expection_set(0);
-
-        not_record_t *line = not_record_make_int_from_ui(position.line);
-        not_record_t *column = not_record_make_int_from_ui(position.column);
-        not_record_t *offset = not_record_make_int_from_ui(position.offset);
-        not_record_t *path = not_record_make_string(position.path);
-        if ((line == NOT_PTR_ERROR) || (column == NOT_PTR_ERROR) || (offset == NOT_PTR_ERROR) || (path == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
-
-        not_record_object_t *object_line = not_record_make_object("line", line, NULL);
-        if (object_line == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_column = not_record_make_object("column", column, object_line);
-        if (object_column == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_offset = not_record_make_object("offset", offset, object_column);
-        if (object_offset == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_path = not_record_make_object("path", path, object_offset);
-        if (object_path == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        not_record_t *record_position = not_record_create(RECORD_KIND_OBJECT, object_path);
-        if (record_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        char message_str[4096];
-        memset(message_str, 0, 4096);
-        if (format)
-        {
-            va_list arg;
-            va_start(arg, format);
-            vsprintf(message_str, format, arg);
-            va_end(arg);
-        }
-
-        not_record_t *code = not_record_make_int_from_si(ERR_SYNTAX_TYPE);
-        not_record_t *message = not_record_make_string(message_str);
-        if ((code == NOT_PTR_ERROR) || (message == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
-
-        not_record_object_t *object_position = not_record_make_object("position", record_position, NULL);
-        if (object_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_code = not_record_make_object("code", code, object_position);
-        if (object_code == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_message = not_record_make_object("message", message, object_code);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        not_record_t *record_error = not_record_create(RECORD_KIND_OBJECT, object_message);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            not_record_object_destroy(object_message);
-            goto region_fatal;
-        }
-
-        not_thread_t *t = not_thread_get_current();
-        if (!t)
-        {
-            goto region_fatal;
-        }
+        va_list arg;
+        va_start(arg, format);
+        int32_t r1 = not_error_raise_arg(ERR_SYNTAX_TYPE, &position, format, arg);
+        va_end(arg);
 
-        if (NOT_PTR_ERROR == not_queue_right_push(t->interpreter->expections, record_error))
+        if (r1 == 0)
         {
-            goto region_fatal;
+            return;
         }
-
-        not_config_expection_set(1);
-        return;
     }
 
-region_fatal:
     fputs("Traceback:\n", stderr);
 
     char base_path[MAX_PATH];
@@ -636,102 +734,17 @@ void not_error_semantic_by_node(not_node_t *node, const char *format, ...)
 {
     if (not_config_expection_is_enable())
     {
-        not_config_expection_set(0);
-
-        not_position_t position = node->position;
-
-        not_record_t *line = not_record_make_int_from_ui(position.line);
-        not_record_t *column = not_record_make_int_from_ui(position.column);
-        not_record_t *offset = not_record_make_int_from_ui(position.offset);
-        not_record_t *path = not_record_make_string(position.path);
-        if ((line == NOT_PTR_ERROR) || (column == NOT_PTR_ERROR) || (offset == NOT_PTR_ERROR) || (path == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
-
-        not_record_object_t *object_line = not_record_make_object("line", line, NULL);
-        if (object_line == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_column = not_record_make_object("column", column, object_line);
-        if (object_column == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_offset = not_record_make_object("offset", offset, object_column);
-        if (object_offset == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_path = not_record_make_object("path", path, object_offset);
-        if (object_path == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        not_record_t *record_position = not_record_create(RECORD_KIND_OBJECT, object_path);
-        if (record_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        char message_str[4096];
-        memset(message_str, 0, 4096);
-        if (format)
-        {
-            va_list arg;
-            va_start(arg, format);
-            vsprintf(message_str, format, arg);
-            va_end(arg);
-        }
-
-        not_record_t *code = not_record_make_int_from_si(ERR_SEMANTIC_TYPE);
-        not_record_t *message = not_record_make_string(message_str);
-        if ((code == NOT_PTR_ERROR) || (message == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
-
-        not_record_object_t *object_position = not_record_make_object("position", record_position, NULL);
-        if (object_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_code = not_record_make_object("code", code, object_position);
-        if (object_code == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_message = not_record_make_object("message", message, object_code);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        not_record_t *record_error = not_record_create(RECORD_KIND_OBJECT, object_message);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            not_record_object_destroy(object_message);
-            goto region_fatal;
-        }
-
-        not_thread_t *t = not_thread_get_current();
-        if (!t)
-        {
-            goto region_fatal;
-        }
+        va_list arg;
+        va_start(arg, format);
+        int32_t r1 = not_error_raise_arg(ERR_SEMANTIC_TYPE, &node->position, format, arg);
+        va_end(arg);
 
-        if (NOT_PTR_ERROR == not_queue_right_push(t->interpreter->expections, record_error))
+        if (r1 == 0)
         {
-            goto region_fatal;
+            return;
         }
-
-        not_config_expection_set(1);
-        return;
     }
 
-region_fatal:
     fputs("Traceback:\n", stderr);
 
     not_position_t position = node->position;
@@ -904,102 +917,17 @@ void not_error_runtime_by_node(not_node_t *node, const char *format, ...)
 {
     if (not_config_expection_is_enable())
     {
-        not_config_expection_set(0);
-
-        not_position_t position = node->position;
-
-        not_record_t *line = not_record_make_int_from_ui(position.line);
-        not_record_t *column = not_record_make_int_from_ui(position.column);
-        not_record_t *offset = not_record_make_int_from_ui(position.offset);
-        not_record_t *path = not_record_make_string(position.path);
-        if ((line == NOT_PTR_ERROR) || (column == NOT_PTR_ERROR) || (offset == NOT_PTR_ERROR) || (path == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
-
-        not_record_object_t *object_line = not_record_make_object("line", line, NULL);
-        if (object_line == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_column = not_record_make_object("column", column, object_line);
-        if (object_column == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_offset = not_record_make_object("offset", offset, object_column);
-        if (object_offset == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_path = not_record_make_object("path", path, object_offset);
-        if (object_path == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        not_record_t *record_position = not_record_create(RECORD_KIND_OBJECT, object_path);
-        if (record_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        char message_str[4096];
-        memset(message_str, 0, 4096);
-        if (format)
-        {
-            va_list arg;
-            va_start(arg, format);
-            vsprintf(message_str, format, arg);
-            va_end(arg);
-        }
-
-        not_record_t *code = not_record_make_int_from_si(ERR_RUNTIME_TYPE);
-        not_record_t *message = not_record_make_string(message_str);
-        if ((code == NOT_PTR_ERROR) || (message == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
-
-        not_record_object_t *object_position = not_record_make_object("position", record_position, NULL);
-        if (object_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_code = not_record_make_object("code", code, object_position);
-        if (object_code == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_message = not_record_make_object("message", message, object_code);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        not_record_t *record_error = not_record_create(RECORD_KIND_OBJECT, object_message);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            not_record_object_destroy(object_message);
-            goto region_fatal;
-        }
-
-        not_thread_t *t = not_thread_get_current();
-        if (!t)
-        {
-            goto region_fatal;
-        }
+        va_list arg;
+        va_start(arg, format);
+        int32_t r1 = not_error_raise_arg(ERR_RUNTIME_TYPE, &node->position, format, arg);
+        va_end(arg);
 
-        if (NOT_PTR_ERROR == not_queue_right_push(t->interpreter->expections, record_error))
+        if (r1 == 0)
         {
-            goto region_fatal;
+            return;
         }
-
-        not_config_expection_set(1);
-        return;
     }
 
-region_fatal:
     fputs("Traceback:\n", stderr);
 
     not_position_t position = node->position;
@@ -1172,102 +1100,17 @@ void not_error_type_by_node(not_node_t *node, const char *format, ...)
 {
     if (not_config_expection_is_enable())
     {
-        not_config_expection_set(0);
-
-        not_position_t position = node->position;
-
-        not_record_t *line = not_record_make_int_from_ui(position.line);
-        not_record_t *column = not_record_make_int_from_ui(position.column);
-        not_record_t *offset = not_record_make_int_from_ui(position.offset);
-        not_record_t *path = not_record_make_string(position.path);
-        if ((line == NOT_PTR_ERROR) || (column == NOT_PTR_ERROR) || (offset == NOT_PTR_ERROR) || (path == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
-
-        not_record_object_t *object_line = not_record_make_object("line", line, NULL);
-        if (object_line == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_column = not_record_make_object("column", column, object_line);
-        if (object_column == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_offset = not_record_make_object("offset", offset, object_column);
-        if (object_offset == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_path = not_record_make_object("path", path, object_offset);
-        if (object_path == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        not_record_t *record_position = not_record_create(RECORD_KIND_OBJECT, object_path);
-        if (record_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        char message_str[4096];
-        memset(message_str, 0, 4096);
-        if (format)
-        {
-            va_list arg;
-            va_start(arg, format);
-            vsprintf(message_str, format, arg);
-            va_end(arg);
-        }
-
-        not_record_t *code = not_record_make_int_from_si(ERR_TYPE_TYPE);
-        not_record_t *message = not_record_make_string(message_str);
-        if ((code == NOT_PTR_ERROR) || (message == NOT_PTR_ERROR))
-        {
-            goto region_fatal;
-        }
-
-        not_record_object_t *object_position = not_record_make_object("position", record_position, NULL);
-        if (object_position == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_code = not_record_make_object("code", code, object_position);
-        if (object_code == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-        not_record_object_t *object_message = not_record_make_object("message", message, object_code);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            goto region_fatal;
-        }
-
-        not_record_t *record_error = not_record_create(RECORD_KIND_OBJECT, object_message);
-        if (object_message == NOT_PTR_ERROR)
-        {
-            not_record_object_destroy(object_message);
-            goto region_fatal;
-        }
-
-        not_thread_t *t = not_thread_get_current();
-        if (!t)
-        {
-            goto region_fatal;
-        }
+        va_list arg;
+        va_start(arg, format);
+        int32_t r1 = not_error_raise_arg(ERR_TYPE_TYPE, &node->position, format, arg);
+        va_end(arg);
 
-        if (NOT_PTR_ERROR == not_queue_right_push(t->interpreter->expections, record_error))
+        if (r1 == 0)
         {
-            goto region_fatal;
+            return;
         }
-
-        not_config_expection_set(1);
-        return;
     }
 
-region_fatal:
     fputs("Traceback:\n", stderr);
 
     not_position_t position = node->position;
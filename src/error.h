@@ -4,10 +4,45 @@
 
 typedef struct not_node not_node_t;
 typedef struct not_position not_position_t;
+typedef struct not_record not_record_t;
+
+#define NOT_ERROR_MAX_TRACE 32
+
+typedef struct not_error
+{
+    /* set while an error is raised and not yet caught or printed */
+    int32_t pending;
+    int32_t code;
+    int32_t positioned;
+    uint64_t line;
+    uint64_t column;
+    uint64_t offset;
+    char path[MAX_PATH];
+    char message[4096];
+    /* innermost calls at the time of the error, callee and call site */
+    uint64_t depth;
+    not_node_t *callees[NOT_ERROR_MAX_TRACE];
+    not_node_t *sites[NOT_ERROR_MAX_TRACE];
+} not_error_t;
 
 int32_t
 not_error_init();
 
+not_error_t *
+not_error_create();
+
+void not_error_destroy(not_error_t *error);
+
+void not_error_throw(not_record_t *value);
+
+int32_t
+not_error_is_pending();
+
+void not_error_clear();
+
+not_record_t *
+not_error_take();
+
 void not_error_no_memory();
 
 void not_error_system(const char *format, ...);
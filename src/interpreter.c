@@ -3,6 +3,9 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <assert.h>
+#include <gmp.h>
+#include <mpfr.h>
+#include <jansson.h>
 
 #include "types/types.h"
 #include "utils/path.h"
@@ -12,6 +15,7 @@
 #include "mutex.h"
 #include "memory.h"
 #include "interpreter.h"
+#include "interpreter/record.h"
 
 not_interpreter_t *
 not_interpreter_create()
@@ -23,9 +27,11 @@ not_interpreter_create()
         return NOT_PTR_ERROR;
     }
 
-    it->expections = not_queue_create();
-    if (it->expections == NOT_PTR_ERROR)
+    it->error = not_error_create();
+    if (it->error == NOT_PTR_ERROR)
     {
+        not_memory_free(it);
+        not_error_no_memory();
         return NOT_PTR_ERROR;
     }
 
@@ -34,6 +40,10 @@ not_interpreter_create()
 
 void not_interpreter_destroy(not_interpreter_t *it)
 {
-    not_queue_destroy(it->expections);
+    if (it->expection)
+    {
+        not_record_link_decrease(it->expection);
+    }
+    not_error_destroy(it->error);
     not_memory_free(it);
 }
@@ -3,11 +3,32 @@
 #define __INTERPRETER_H__ 1
 
 typedef struct not_record not_record_t;
+typedef struct not_error not_error_t;
+typedef struct not_node not_node_t;
+
+/* a function entered through a call, kept on the C stack of its caller */
+typedef struct not_interpreter_call
+{
+    not_node_t *callee;
+    not_node_t *site;
+    struct not_interpreter_call *previous;
+} not_interpreter_call_t;
 
 typedef struct not_interpreter
 {
-    not_record_t *rax;
-    not_queue_t *expections;
+    /* value thrown and not caught yet */
+    not_record_t *expection;
+    /* runtime error raised and not built into a record yet */
+    not_error_t *error;
+    /* generator currently running on this thread */
+    void *generator;
+    /* strip of the function frame entered through a call expression */
+    void *frame;
+    /* callee and bound inputs of a tail call waiting for its frame */
+    not_record_t *tail;
+    void *tail_strip;
+    /* innermost call running on this thread */
+    not_interpreter_call_t *calls;
 } not_interpreter_t;
 
 not_interpreter_t *
@@ -507,11 +507,382 @@ not_addative_minus(not_node_t *node, not_record_t *left, not_record_t *right, no
     return not_record_make_nan();
 }
 
+/*
+ * Both operands were proven numeric, or both strings under '+', by the
+ * typing pass. The kind and the flags are rechecked here and NULL hands the
+ * node back to the generic path.
+ */
+static not_record_t *
+not_addative_typed(not_node_t *node, not_record_t *left, not_record_t *right)
+{
+    if ((left->kind != right->kind) || left->null || left->undefined || left->nan || right->null || right->undefined || right->nan)
+    {
+        return NULL;
+    }
+
+    if (left->kind == RECORD_KIND_INT)
+    {
+        mpz_t *basic = (mpz_t *)not_memory_calloc(1, sizeof(mpz_t));
+        if (basic == NULL)
+        {
+            not_error_no_memory();
+            return NOT_PTR_ERROR;
+        }
+
+        mpz_init(*basic);
+
+        if (node->kind == NODE_KIND_PLUS)
+        {
+            mpz_add(*basic, (*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+        }
+        else
+        {
+            mpz_sub(*basic, (*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+        }
+
+        not_record_t *record = not_record_create(RECORD_KIND_INT, basic);
+        if (record == NOT_PTR_ERROR)
+        {
+            mpz_clear(*basic);
+            not_memory_free(basic);
+            return NOT_PTR_ERROR;
+        }
+
+        return record;
+    }
+    else if (left->kind == RECORD_KIND_FLOAT)
+    {
+        mpf_t *basic = (mpf_t *)not_memory_calloc(1, sizeof(mpf_t));
+        if (basic == NULL)
+        {
+            not_error_no_memory();
+            return NOT_PTR_ERROR;
+        }
+
+        mpf_init(*basic);
+
+        if (node->kind == NODE_KIND_PLUS)
+        {
+            mpf_add(*basic, (*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+        }
+        else
+        {
+            mpf_sub(*basic, (*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+        }
+
+        not_record_t *record = not_record_create(RECORD_KIND_FLOAT, basic);
+        if (record == NOT_PTR_ERROR)
+        {
+            mpf_clear(*basic);
+            not_memory_free(basic);
+            return NOT_PTR_ERROR;
+        }
+
+        return record;
+    }
+    else if ((left->kind == RECORD_KIND_STRING) && (node->kind == NODE_KIND_PLUS))
+    {
+        size_t length1 = strlen((char *)left->value);
+        size_t length2 = strlen((char *)right->value);
+
+        char *basic = (char *)not_memory_calloc(length1 + length2 + 1, sizeof(char));
+        if (basic == NULL)
+        {
+            not_error_no_memory();
+            return NOT_PTR_ERROR;
+        }
+
+        memcpy(basic, left->value, length1);
+        memcpy(basic + length1, right->value, length2 + 1);
+
+        not_record_t *record = not_record_create(RECORD_KIND_STRING, basic);
+        if (record == NOT_PTR_ERROR)
+        {
+            not_memory_free(basic);
+            return NOT_PTR_ERROR;
+        }
+
+        return record;
+    }
+
+    return NULL;
+}
+
+/*
+ * Nested int arithmetic is folded through a small per-thread stack of mpz
+ * registers, only the value of the whole tree is boxed into a record.
+ */
+#define NOT_ADDATIVE_REGISTERS 32
+
+static _Thread_local mpz_t not_addative_registers[NOT_ADDATIVE_REGISTERS];
+static _Thread_local int32_t not_addative_registers_init = 0;
+static _Thread_local int32_t not_addative_registers_top = 0;
+
+typedef struct not_addative_operand
+{
+    not_record_t *record;
+    mpz_t *value;
+} not_addative_operand_t;
+
+static mpz_t *
+not_addative_register_push()
+{
+    if (not_addative_registers_top >= NOT_ADDATIVE_REGISTERS)
+    {
+        return NULL;
+    }
+
+    if (not_addative_registers_top >= not_addative_registers_init)
+    {
+        mpz_init(not_addative_registers[not_addative_registers_top]);
+        not_addative_registers_init += 1;
+    }
+
+    return &not_addative_registers[not_addative_registers_top++];
+}
+
+/* clears the registers of the calling thread, run by each thread before it ends */
+void not_addative_release()
+{
+    for (int32_t i = 0; i < not_addative_registers_init; i++)
+    {
+        mpz_clear(not_addative_registers[i]);
+    }
+
+    not_addative_registers_init = 0;
+    not_addative_registers_top = 0;
+}
+
+static not_node_t *
+not_addative_scratch_unwrap(not_node_t *node)
+{
+    while (node->kind == NODE_KIND_PARENTHESIS)
+    {
+        not_node_unary_t *unary = (not_node_unary_t *)node->value;
+        node = unary->right;
+    }
+
+    if ((node->kind == NODE_KIND_PLUS) || (node->kind == NODE_KIND_MINUS) || (node->kind == NODE_KIND_MUL))
+    {
+        return node;
+    }
+
+    return NULL;
+}
+
+static mpz_t *
+not_addative_scratch_value(not_addative_operand_t *operand)
+{
+    if (operand->value != NULL)
+    {
+        return operand->value;
+    }
+
+    not_record_t *record = operand->record;
+    if ((record->kind == RECORD_KIND_INT) && !record->null && !record->undefined && !record->nan)
+    {
+        return (mpz_t *)record->value;
+    }
+
+    return NULL;
+}
+
+static int32_t
+not_addative_scratch_eval(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin, not_addative_operand_t *result);
+
+static int32_t
+not_addative_scratch_apply(not_node_t *node, not_addative_operand_t *left, not_addative_operand_t *right, not_node_t *applicant, not_addative_operand_t *result)
+{
+    mpz_t *x = not_addative_scratch_value(left);
+    mpz_t *y = not_addative_scratch_value(right);
+
+    if ((x != NULL) && (y != NULL))
+    {
+        mpz_t *target = left->value ? left->value : (right->value ? right->value : not_addative_register_push());
+        if (target != NULL)
+        {
+            if (node->kind == NODE_KIND_PLUS)
+            {
+                mpz_add(*target, *x, *y);
+            }
+            else if (node->kind == NODE_KIND_MINUS)
+            {
+                mpz_sub(*target, *x, *y);
+            }
+            else
+            {
+                mpz_mul(*target, *x, *y);
+            }
+
+            if (left->value && right->value)
+            {
+                not_addative_registers_top -= 1;
+            }
+
+            if (left->record && (not_record_link_decrease(left->record) < 0))
+            {
+                return -1;
+            }
+
+            if (right->record && (not_record_link_decrease(right->record) < 0))
+            {
+                return -1;
+            }
+
+            result->record = NULL;
+            result->value = target;
+            return 0;
+        }
+    }
+
+    /* an operand is not a plain int, the generic operator takes the node */
+    if (right->value != NULL)
+    {
+        right->record = not_record_make_int_from_z(*right->value);
+        right->value = NULL;
+        not_addative_registers_top -= 1;
+        if (right->record == NOT_PTR_ERROR)
+        {
+            if (left->record)
+            {
+                not_record_link_decrease(left->record);
+            }
+            return -1;
+        }
+    }
+
+    if (left->value != NULL)
+    {
+        left->record = not_record_make_int_from_z(*left->value);
+        left->value = NULL;
+        not_addative_registers_top -= 1;
+        if (left->record == NOT_PTR_ERROR)
+        {
+            not_record_link_decrease(right->record);
+            return -1;
+        }
+    }
+
+    not_record_t *record = NULL;
+    if (node->kind == NODE_KIND_PLUS)
+    {
+        record = not_addative_plus(node, left->record, right->record, applicant);
+    }
+    else if (node->kind == NODE_KIND_MINUS)
+    {
+        record = not_addative_minus(node, left->record, right->record, applicant);
+    }
+    else
+    {
+        record = not_multipicative_mul(node, left->record, right->record, applicant);
+    }
+
+    if (not_record_link_decrease(left->record) < 0)
+    {
+        return -1;
+    }
+
+    if (not_record_link_decrease(right->record) < 0)
+    {
+        return -1;
+    }
+
+    if (record == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    result->record = record;
+    result->value = NULL;
+    return 0;
+}
+
+static int32_t
+not_addative_scratch_eval(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin, not_addative_operand_t *result)
+{
+    not_node_t *arithmetic = not_addative_scratch_unwrap(node);
+    if (arithmetic == NULL)
+    {
+        not_record_t *record = not_primary_operand(node, strip, applicant, origin);
+        if (record == NOT_PTR_ERROR)
+        {
+            return -1;
+        }
+
+        result->record = record;
+        result->value = NULL;
+        return 0;
+    }
+
+    not_node_binary_t *binary = (not_node_binary_t *)arithmetic->value;
+
+    not_addative_operand_t left;
+    if (not_addative_scratch_eval(binary->left, strip, applicant, origin, &left) < 0)
+    {
+        return -1;
+    }
+
+    not_addative_operand_t right;
+    if (not_addative_scratch_eval(binary->right, strip, applicant, origin, &right) < 0)
+    {
+        if (left.record)
+        {
+            not_record_link_decrease(left.record);
+        }
+        return -1;
+    }
+
+    return not_addative_scratch_apply(arithmetic, &left, &right, applicant, result);
+}
+
+/*
+ * Evaluates a proven int tree of + - * with at least one nested operation,
+ * NULL hands the node back to the usual one-record-per-operator path.
+ */
+not_record_t *
+not_addative_scratch(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
+{
+    not_node_binary_t *binary = (not_node_binary_t *)node->value;
+    if (binary->typed != NODE_TYPED_INT)
+    {
+        return NULL;
+    }
+
+    if ((not_addative_scratch_unwrap(binary->left) == NULL) && (not_addative_scratch_unwrap(binary->right) == NULL))
+    {
+        return NULL;
+    }
+
+    int32_t top = not_addative_registers_top;
+
+    not_addative_operand_t result;
+    if (not_addative_scratch_eval(node, strip, applicant, origin, &result) < 0)
+    {
+        not_addative_registers_top = top;
+        return NOT_PTR_ERROR;
+    }
+
+    if (result.value != NULL)
+    {
+        not_record_t *record = not_record_make_int_from_z(*result.value);
+        not_addative_registers_top = top;
+        return record;
+    }
+
+    return result.record;
+}
+
 not_record_t *
 not_addative(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
     if (node->kind == NODE_KIND_PLUS)
     {
+        not_record_t *scratch = not_addative_scratch(node, strip, applicant, origin);
+        if (scratch != NULL)
+        {
+            return scratch;
+        }
+
         not_node_binary_t *binary = (not_node_binary_t *)node->value;
         not_record_t *left = not_addative(binary->left, strip, applicant, origin);
         if (left == NOT_PTR_ERROR)
@@ -526,7 +897,16 @@ not_addative(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_no
             return NOT_PTR_ERROR;
         }
 
-        not_record_t *record = not_addative_plus(node, left, right, applicant);
+        not_record_t *record = NULL;
+        if (binary->typed != NODE_TYPED_NONE)
+        {
+            record = not_addative_typed(node, left, right);
+        }
+
+        if (record == NULL)
+        {
+            record = not_addative_plus(node, left, right, applicant);
+        }
 
         if (not_record_link_decrease(left) < 0)
         {
@@ -542,6 +922,12 @@ not_addative(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_no
     }
     else if (node->kind == NODE_KIND_MINUS)
     {
+        not_record_t *scratch = not_addative_scratch(node, strip, applicant, origin);
+        if (scratch != NULL)
+        {
+            return scratch;
+        }
+
         not_node_binary_t *binary = (not_node_binary_t *)node->value;
         not_record_t *left = not_addative(binary->left, strip, applicant, origin);
         if (left == NOT_PTR_ERROR)
@@ -556,7 +942,16 @@ not_addative(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_no
             return NOT_PTR_ERROR;
         }
 
-        not_record_t *record = not_addative_minus(node, left, right, applicant);
+        not_record_t *record = NULL;
+        if (binary->typed != NODE_TYPED_NONE)
+        {
+            record = not_addative_typed(node, left, right);
+        }
+
+        if (record == NULL)
+        {
+            record = not_addative_minus(node, left, right, applicant);
+        }
 
         if (not_record_link_decrease(left) < 0)
         {
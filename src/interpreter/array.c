@@ -58,24 +58,28 @@ not_call_for_bracket(not_node_t *base, not_node_t *arguments, not_strip_t *strip
                     return NOT_PTR_ERROR;
                 }
 
-                int32_t r1 = not_execute_fun(item, strip_copy, applicant);
+                not_record_t *rax = NULL;
+                int32_t r1 = not_execute_fun(item, strip_copy, applicant, &rax);
                 if (r1 == -1)
                 {
+                    if (rax)
+                    {
+                        not_record_link_decrease(rax);
+                    }
                     not_strip_destroy(strip_copy);
                     return NOT_PTR_ERROR;
                 }
 
                 if (not_strip_destroy(strip_copy) < 0)
                 {
+                    if (rax)
+                    {
+                        not_record_link_decrease(rax);
+                    }
                     return NOT_PTR_ERROR;
                 }
 
-                not_record_t *rax = not_thread_get_and_set_rax(NULL);
-                if (rax == NOT_PTR_ERROR)
-                {
-                    return NOT_PTR_ERROR;
-                }
-                else if (!rax)
+                if (!rax)
                 {
                     rax = not_record_make_undefined();
                 }
@@ -100,6 +104,143 @@ record_to_mpz(not_record_t *value, mpz_t num)
     }
 }
 
+/*
+ * A tuple read with a single int index, walked with a native counter
+ * instead of the mpz bookkeeping the slice form needs.
+ */
+static not_record_t *
+not_array_tuple_item(not_node_t *node, not_record_t *base, not_node_t *item1, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
+{
+    not_node_argument_t *argument = (not_node_argument_t *)item1->value;
+
+    not_record_t *record_arg = not_primary_operand(argument->key, strip, applicant, origin);
+    if (record_arg == NOT_PTR_ERROR)
+    {
+        not_record_link_decrease(base);
+        return NOT_PTR_ERROR;
+    }
+
+    if (record_arg->kind != RECORD_KIND_INT)
+    {
+        not_error_type_by_node(item1, "'%s' must be of '%s' type", "key", "int");
+        not_record_link_decrease(record_arg);
+        not_record_link_decrease(base);
+        return NOT_PTR_ERROR;
+    }
+
+    int32_t bounded = 1;
+    int64_t index = 0;
+    if (mpz_sgn(*(mpz_t *)(record_arg->value)) >= 0)
+    {
+        if (mpz_fits_slong_p(*(mpz_t *)(record_arg->value)))
+        {
+            index = mpz_get_si(*(mpz_t *)(record_arg->value));
+        }
+        else
+        {
+            bounded = 0;
+        }
+    }
+    else
+    {
+        /* a negative index counts from the end, wrapping as often as needed */
+        uint64_t length = 0;
+        for (not_record_tuple_t *item = (not_record_tuple_t *)base->value; item != NULL; item = item->next)
+        {
+            length += 1;
+        }
+
+        if (length > 0)
+        {
+            index = (int64_t)mpz_fdiv_ui(*(mpz_t *)(record_arg->value), length);
+        }
+        else
+        {
+            bounded = 0;
+        }
+    }
+
+    if (not_record_link_decrease(record_arg) < 0)
+    {
+        not_record_link_decrease(base);
+        return NOT_PTR_ERROR;
+    }
+
+    if (bounded)
+    {
+        int64_t cnt = 0;
+        for (not_record_tuple_t *item = (not_record_tuple_t *)base->value; item != NULL; item = item->next, cnt++)
+        {
+            if (cnt == index)
+            {
+                not_record_link_increase(item->value);
+                if (not_record_link_decrease(base) < 0)
+                {
+                    not_record_link_decrease(item->value);
+                    return NOT_PTR_ERROR;
+                }
+                return item->value;
+            }
+        }
+    }
+
+    not_error_type_by_node(node, "array bounds exceeded");
+    not_record_link_decrease(base);
+    return NOT_PTR_ERROR;
+}
+
+/*
+ * Brings the bounds of a slice over length items into [0, length), negative
+ * ones counting from the end, and clamps the step to the length, since a
+ * longer step leaves the slice after its first item anyway. Everything then
+ * fits an int64 and the walk cannot overflow.
+ */
+static int32_t
+not_array_slice_bounds(not_node_t *node, mpz_t start, mpz_t stop, mpz_t step, int64_t length, uint64_t arg_cnt,
+                       int64_t *n_start, int64_t *n_stop, int64_t *n_step)
+{
+    if ((length == 0) || (mpz_cmp_si(start, length) >= 0) || (mpz_cmp_si(stop, length) >= 0))
+    {
+        not_error_type_by_node(node, "array bounds exceeded");
+        return -1;
+    }
+
+    mpz_fdiv_r_ui(start, start, (unsigned long)length);
+    mpz_fdiv_r_ui(stop, stop, (unsigned long)length);
+
+    if (arg_cnt == 2)
+    {
+        if (mpz_cmp(start, stop) > 0)
+        {
+            mpz_set_si(step, -1);
+        }
+    }
+
+    if (mpz_cmp_si(step, 0) == 0)
+    {
+        not_error_type_by_node(node, "slice step cannot be zero");
+        return -1;
+    }
+
+    if (mpz_cmpabs_ui(step, (unsigned long)length) > 0)
+    {
+        mpz_set_si(step, (mpz_sgn(step) > 0) ? length : -length);
+    }
+
+    *n_start = mpz_get_si(start);
+    *n_stop = mpz_get_si(stop);
+    *n_step = mpz_get_si(step);
+
+    return 0;
+}
+
+/* whether a slice walk at term has another step left inside [low, high] */
+static int32_t
+not_array_slice_next(int64_t term, int64_t low, int64_t high, int64_t step)
+{
+    return (step > 0) ? (high - term >= step) : (term - low >= -step);
+}
+
 not_record_t *
 not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
@@ -248,6 +389,12 @@ not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_
                 return NOT_PTR_ERROR;
             }
 
+            not_node_argument_t *argument1 = (not_node_argument_t *)block->items->value;
+            if ((arg_cnt == 1) && (argument1->value == NULL))
+            {
+                return not_array_tuple_item(node, base, block->items, strip, applicant, origin);
+            }
+
             mpz_t start, stop, step;
             mpz_init(start);
             mpz_init(stop);
@@ -331,188 +478,91 @@ not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_
 
             if (arg_cnt > 1)
             {
-                if (mpz_cmp(start, length) >= 0)
+                int64_t n_length = mpz_get_si(length);
+                int64_t n_start = 0, n_stop = 0, n_step = 0;
+                int32_t r1 = not_array_slice_bounds(node, start, stop, step, n_length, arg_cnt, &n_start, &n_stop, &n_step);
+
+                mpz_clear(start);
+                mpz_clear(stop);
+                mpz_clear(step);
+                mpz_clear(term);
+                mpz_clear(cnt);
+                mpz_clear(length);
+
+                if (r1 < 0)
                 {
-                    not_error_type_by_node(node, "array bounds exceeded");
-                    mpz_clear(start);
-                    mpz_clear(stop);
-                    mpz_clear(step);
-                    mpz_clear(term);
-                    mpz_clear(cnt);
-                    mpz_clear(length);
                     not_record_link_decrease(base);
                     return NOT_PTR_ERROR;
                 }
 
-                if (mpz_cmp(stop, length) >= 0)
+                /* index the list once so the slice is linear in its length */
+                not_record_t **items = (not_record_t **)not_memory_calloc(n_length + 1, sizeof(not_record_t *));
+                if (items == NULL)
                 {
-                    not_error_type_by_node(node, "array bounds exceeded");
-                    mpz_clear(start);
-                    mpz_clear(stop);
-                    mpz_clear(step);
-                    mpz_clear(term);
-                    mpz_clear(cnt);
-                    mpz_clear(length);
+                    not_error_no_memory();
                     not_record_link_decrease(base);
                     return NOT_PTR_ERROR;
                 }
 
-                while (mpz_cmp_si(start, 0) < 0)
-                {
-                    mpz_add(start, length, start);
-                }
-
-                while (mpz_cmp_si(stop, 0) < 0)
-                {
-                    mpz_add(stop, length, stop);
-                }
-
-                if (arg_cnt == 2)
+                int64_t n = 0;
+                for (not_record_tuple_t *item = (not_record_tuple_t *)base->value; item != NULL; item = item->next)
                 {
-                    if (mpz_cmp(start, stop) > 0)
-                    {
-                        mpz_set_si(step, -1);
-                    }
+                    items[n++] = item->value;
                 }
 
-                mpz_set(term, start);
+                int64_t n_low = n_start <= n_stop ? n_start : n_stop;
+                int64_t n_high = n_start <= n_stop ? n_stop : n_start;
 
                 not_record_tuple_t *top = NULL, *declaration = NULL;
-                if (mpz_cmp(start, stop) <= 0)
+                for (int64_t term = n_start;; term += n_step)
                 {
-                    while ((mpz_cmp(term, start) >= 0) && (mpz_cmp(term, stop) <= 0))
+                    not_record_link_increase(items[term]);
+
+                    not_record_tuple_t *tuple = not_record_make_tuple(items[term], NULL);
+                    if (tuple == NOT_PTR_ERROR)
                     {
-                        mpz_set_si(cnt, 0);
-                        for (not_record_tuple_t *item = (not_record_tuple_t *)base->value; item != NULL; item = item->next)
+                        not_record_link_decrease(items[term]);
+                        not_memory_free(items);
+
+                        if (top)
                         {
-                            if (mpz_cmp(term, cnt) == 0)
+                            if (not_record_tuple_destroy(top) < 0)
                             {
-                                not_record_link_increase(item->value);
-
-                                not_record_tuple_t *tuple = not_record_make_tuple(item->value, NULL);
-                                if (tuple == NOT_PTR_ERROR)
-                                {
-                                    if (not_record_link_decrease(item->value) < 0)
-                                    {
-                                        mpz_clear(start);
-                                        mpz_clear(stop);
-                                        mpz_clear(step);
-                                        mpz_clear(term);
-                                        mpz_clear(cnt);
-                                        mpz_clear(length);
-                                        return NOT_PTR_ERROR;
-                                    }
-                                    mpz_clear(start);
-                                    mpz_clear(stop);
-                                    mpz_clear(step);
-                                    mpz_clear(term);
-                                    mpz_clear(cnt);
-                                    mpz_clear(length);
-
-                                    if (top)
-                                    {
-                                        if (not_record_tuple_destroy(top) < 0)
-                                        {
-                                            not_record_link_decrease(base);
-                                            return NOT_PTR_ERROR;
-                                        }
-                                    }
-
-                                    not_record_link_decrease(base);
-                                    return NOT_PTR_ERROR;
-                                }
-
-                                if (declaration == NULL)
-                                {
-                                    declaration = tuple;
-                                    top = tuple;
-                                }
-                                else
-                                {
-                                    declaration->next = tuple;
-                                    declaration = tuple;
-                                }
-
-                                break;
+                                not_record_link_decrease(base);
+                                return NOT_PTR_ERROR;
                             }
-                            mpz_add_ui(cnt, cnt, 1);
                         }
-                        mpz_add(term, term, step);
+
+                        not_record_link_decrease(base);
+                        return NOT_PTR_ERROR;
                     }
-                }
-                else
-                {
-                    while ((mpz_cmp(term, stop) >= 0) && (mpz_cmp(term, start) <= 0))
+
+                    if (declaration == NULL)
                     {
-                        mpz_set_si(cnt, 0);
-                        for (not_record_tuple_t *item = (not_record_tuple_t *)base->value; item != NULL; item = item->next)
-                        {
-                            if (mpz_cmp(term, cnt) == 0)
-                            {
-                                not_record_link_increase(item->value);
-
-                                not_record_tuple_t *tuple = not_record_make_tuple(item->value, NULL);
-                                if (tuple == NOT_PTR_ERROR)
-                                {
-                                    if (not_record_link_decrease(item->value) < 0)
-                                    {
-                                        mpz_clear(start);
-                                        mpz_clear(stop);
-                                        mpz_clear(step);
-                                        mpz_clear(term);
-                                        mpz_clear(cnt);
-                                        mpz_clear(length);
-                                        return NOT_PTR_ERROR;
-                                    }
-                                    mpz_clear(start);
-                                    mpz_clear(stop);
-                                    mpz_clear(step);
-                                    mpz_clear(term);
-                                    mpz_clear(cnt);
-                                    mpz_clear(length);
-
-                                    if (top)
-                                    {
-                                        if (not_record_tuple_destroy(top) < 0)
-                                        {
-                                            not_record_link_decrease(base);
-                                            return NOT_PTR_ERROR;
-                                        }
-                                    }
-
-                                    not_record_link_decrease(base);
-                                    return NOT_PTR_ERROR;
-                                }
-
-                                if (declaration == NULL)
-                                {
-                                    declaration = tuple;
-                                    top = tuple;
-                                }
-                                else
-                                {
-                                    declaration->next = tuple;
-                                    declaration = tuple;
-                                }
-
-                                break;
-                            }
-                            mpz_add_ui(cnt, cnt, 1);
-                        }
-                        mpz_add(term, term, step);
+                        declaration = tuple;
+                        top = tuple;
+                    }
+                    else
+                    {
+                        declaration->next = tuple;
+                        declaration = tuple;
+                    }
+
+                    if (!not_array_slice_next(term, n_low, n_high, n_step))
+                    {
+                        break;
                     }
                 }
 
-                mpz_clear(start);
-                mpz_clear(stop);
-                mpz_clear(step);
-                mpz_clear(term);
-                mpz_clear(cnt);
-                mpz_clear(length);
+                not_memory_free(items);
 
                 not_record_t *result = not_record_create(RECORD_KIND_TUPLE, top);
                 if (result == NOT_PTR_ERROR)
                 {
+                    if (top)
+                    {
+                        not_record_tuple_destroy(top);
+                    }
                     not_record_link_decrease(base);
                     return NOT_PTR_ERROR;
                 }
@@ -526,7 +576,7 @@ not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_
             }
             else
             {
-                if (mpz_cmp(start, length) >= 0)
+                if ((mpz_sgn(length) == 0) || (mpz_cmp(start, length) >= 0))
                 {
                     not_error_type_by_node(node, "array bounds exceeded");
                     mpz_clear(start);
@@ -539,10 +589,8 @@ not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_
                     return NOT_PTR_ERROR;
                 }
 
-                while (mpz_cmp_si(start, 0) < 0)
-                {
-                    mpz_add(start, length, start);
-                }
+                /* negative indexes count from the end */
+                mpz_fdiv_r(start, start, length);
 
                 mpz_set(term, start);
                 for (not_record_tuple_t *item = (not_record_tuple_t *)base->value; item != NULL; item = item->next)
@@ -668,215 +716,86 @@ not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_
 
             if (arg_cnt > 1)
             {
-                if (mpz_cmp(start, length) >= 0)
-                {
-                    not_error_type_by_node(node, "array bounds exceeded");
-                    mpz_clear(start);
-                    mpz_clear(stop);
-                    mpz_clear(step);
-                    mpz_clear(term);
-                    mpz_clear(cnt);
-                    mpz_clear(length);
-                    not_record_link_decrease(base);
-                    return NOT_PTR_ERROR;
-                }
+                int64_t n_start = 0, n_stop = 0, n_step = 0;
+                int32_t r1 = not_array_slice_bounds(node, start, stop, step, mpz_get_si(length), arg_cnt, &n_start, &n_stop, &n_step);
+
+                mpz_clear(start);
+                mpz_clear(stop);
+                mpz_clear(step);
+                mpz_clear(term);
+                mpz_clear(cnt);
+                mpz_clear(length);
 
-                if (mpz_cmp(stop, length) >= 0)
+                if (r1 < 0)
                 {
-                    not_error_type_by_node(node, "array bounds exceeded");
-                    mpz_clear(start);
-                    mpz_clear(stop);
-                    mpz_clear(step);
-                    mpz_clear(term);
-                    mpz_clear(cnt);
-                    mpz_clear(length);
                     not_record_link_decrease(base);
                     return NOT_PTR_ERROR;
                 }
 
-                while (mpz_cmp_si(start, 0) < 0)
-                {
-                    mpz_add(start, length, start);
-                }
-
-                while (mpz_cmp_si(stop, 0) < 0)
-                {
-                    mpz_add(stop, length, stop);
-                }
+                int64_t n_low = n_start <= n_stop ? n_start : n_stop;
+                int64_t n_high = n_start <= n_stop ? n_stop : n_start;
 
-                if (arg_cnt == 2)
+                /* chars are views into the buffer of base, kept alive by its owner */
+                not_record_t *owner = not_record_view_owner(base);
+                if (owner == NOT_PTR_ERROR)
                 {
-                    if (mpz_cmp(start, stop) > 0)
-                    {
-                        mpz_set_si(step, -1);
-                    }
+                    not_record_link_decrease(base);
+                    return NOT_PTR_ERROR;
                 }
 
-                mpz_set(term, start);
-
                 not_record_tuple_t *top = NULL, *declaration = NULL;
-                if (mpz_cmp(start, stop) <= 0)
+                for (int64_t term = n_start;; term += n_step)
                 {
-                    while ((mpz_cmp(term, start) >= 0) && (mpz_cmp(term, stop) <= 0))
+                    not_record_t *item = not_record_make_view(RECORD_KIND_CHAR, (char *)base->value + term, owner);
+                    if (item == NOT_PTR_ERROR)
                     {
-                        mpz_set_si(cnt, 0);
-                        for (char *str = (char *)base->value; str != NULL; str++)
+                        if (top)
                         {
-                            if (mpz_cmp(term, cnt) == 0)
-                            {
-                                not_record_t *item = not_record_create(RECORD_KIND_CHAR, str);
-                                if (item == NOT_PTR_ERROR)
-                                {
-                                    mpz_clear(start);
-                                    mpz_clear(stop);
-                                    mpz_clear(step);
-                                    mpz_clear(term);
-                                    mpz_clear(cnt);
-                                    mpz_clear(length);
-                                    not_record_link_decrease(base);
-
-                                    if (top)
-                                    {
-                                        not_record_tuple_destroy(top);
-                                    }
-                                    return NOT_PTR_ERROR;
-                                }
-                                item->reference = 1;
-
-                                not_record_tuple_t *tuple = not_record_make_tuple(item, NULL);
-                                if (tuple == NOT_PTR_ERROR)
-                                {
-                                    if (not_record_link_decrease(item) < 0)
-                                    {
-                                        mpz_clear(start);
-                                        mpz_clear(stop);
-                                        mpz_clear(step);
-                                        mpz_clear(term);
-                                        mpz_clear(cnt);
-                                        mpz_clear(length);
-                                        return NOT_PTR_ERROR;
-                                    }
-                                    mpz_clear(start);
-                                    mpz_clear(stop);
-                                    mpz_clear(step);
-                                    mpz_clear(term);
-                                    mpz_clear(cnt);
-                                    mpz_clear(length);
-
-                                    if (top)
-                                    {
-                                        not_record_tuple_destroy(top);
-                                    }
-
-                                    not_record_link_decrease(base);
-                                    return NOT_PTR_ERROR;
-                                }
-
-                                if (declaration == NULL)
-                                {
-                                    declaration = tuple;
-                                    top = tuple;
-                                }
-                                else
-                                {
-                                    declaration->next = tuple;
-                                    declaration = tuple;
-                                }
-
-                                break;
-                            }
-                            mpz_add_ui(cnt, cnt, 1);
+                            not_record_tuple_destroy(top);
                         }
-                        mpz_add(term, term, step);
+
+                        not_record_link_decrease(base);
+                        return NOT_PTR_ERROR;
                     }
-                }
-                else
-                {
-                    while ((mpz_cmp(term, stop) >= 0) && (mpz_cmp(term, start) <= 0))
+
+                    not_record_tuple_t *tuple = not_record_make_tuple(item, NULL);
+                    if (tuple == NOT_PTR_ERROR)
                     {
-                        mpz_set_si(cnt, 0);
-                        for (char *str = (char *)base->value; str != NULL; str++)
+                        not_record_link_decrease(item);
+
+                        if (top)
                         {
-                            if (mpz_cmp(term, cnt) == 0)
-                            {
-                                not_record_t *item = not_record_create(RECORD_KIND_CHAR, str);
-                                if (item == NOT_PTR_ERROR)
-                                {
-                                    mpz_clear(start);
-                                    mpz_clear(stop);
-                                    mpz_clear(step);
-                                    mpz_clear(term);
-                                    mpz_clear(cnt);
-                                    mpz_clear(length);
-                                    not_record_link_decrease(base);
-
-                                    if (top)
-                                    {
-                                        not_record_tuple_destroy(top);
-                                    }
-
-                                    return NOT_PTR_ERROR;
-                                }
-                                item->reference = 1;
-
-                                not_record_tuple_t *tuple = not_record_make_tuple(item, NULL);
-                                if (tuple == NOT_PTR_ERROR)
-                                {
-                                    if (not_record_link_decrease(item) < 0)
-                                    {
-                                        mpz_clear(start);
-                                        mpz_clear(stop);
-                                        mpz_clear(step);
-                                        mpz_clear(term);
-                                        mpz_clear(cnt);
-                                        mpz_clear(length);
-                                        return NOT_PTR_ERROR;
-                                    }
-                                    mpz_clear(start);
-                                    mpz_clear(stop);
-                                    mpz_clear(step);
-                                    mpz_clear(term);
-                                    mpz_clear(cnt);
-                                    mpz_clear(length);
-
-                                    if (top)
-                                    {
-                                        not_record_tuple_destroy(top);
-                                    }
-
-                                    not_record_link_decrease(base);
-                                    return NOT_PTR_ERROR;
-                                }
-
-                                if (declaration == NULL)
-                                {
-                                    declaration = tuple;
-                                    top = tuple;
-                                }
-                                else
-                                {
-                                    declaration->next = tuple;
-                                    declaration = tuple;
-                                }
-
-                                break;
-                            }
-                            mpz_add_ui(cnt, cnt, 1);
+                            not_record_tuple_destroy(top);
                         }
-                        mpz_add(term, term, step);
+
+                        not_record_link_decrease(base);
+                        return NOT_PTR_ERROR;
                     }
-                }
 
-                mpz_clear(start);
-                mpz_clear(stop);
-                mpz_clear(step);
-                mpz_clear(term);
-                mpz_clear(cnt);
-                mpz_clear(length);
+                    if (declaration == NULL)
+                    {
+                        declaration = tuple;
+                        top = tuple;
+                    }
+                    else
+                    {
+                        declaration->next = tuple;
+                        declaration = tuple;
+                    }
+
+                    if (!not_array_slice_next(term, n_low, n_high, n_step))
+                    {
+                        break;
+                    }
+                }
 
                 not_record_t *result = not_record_create(RECORD_KIND_TUPLE, top);
                 if (result == NOT_PTR_ERROR)
                 {
+                    if (top)
+                    {
+                        not_record_tuple_destroy(top);
+                    }
                     not_record_link_decrease(base);
                     return NOT_PTR_ERROR;
                 }
@@ -890,7 +809,7 @@ not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_
             }
             else
             {
-                if (mpz_cmp(start, length) >= 0)
+                if ((mpz_sgn(length) == 0) || (mpz_cmp(start, length) >= 0))
                 {
                     not_error_type_by_node(node, "array bounds exceeded");
                     mpz_clear(start);
@@ -903,46 +822,33 @@ not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_
                     return NOT_PTR_ERROR;
                 }
 
-                while (mpz_cmp_si(start, 0) < 0)
+                /* negative indexes count from the end */
+                mpz_fdiv_r(start, start, length);
+
+                not_record_t *owner = not_record_view_owner(base);
+                not_record_t *item = NOT_PTR_ERROR;
+                if (owner != NOT_PTR_ERROR)
                 {
-                    mpz_add(start, length, start);
+                    item = not_record_make_view(RECORD_KIND_CHAR, (char *)base->value + mpz_get_si(start), owner);
                 }
 
-                mpz_set(term, start);
+                mpz_clear(start);
+                mpz_clear(stop);
+                mpz_clear(step);
+                mpz_clear(term);
+                mpz_clear(cnt);
+                mpz_clear(length);
 
-                for (char *str = (char *)base->value; str != NULL; str++)
+                if (not_record_link_decrease(base) < 0)
                 {
-                    if (mpz_cmp(cnt, term) == 0)
+                    if (item != NOT_PTR_ERROR)
                     {
-                        not_record_t *item = not_record_create(RECORD_KIND_CHAR, str);
-                        if (item == NOT_PTR_ERROR)
-                        {
-                            mpz_clear(start);
-                            mpz_clear(stop);
-                            mpz_clear(step);
-                            mpz_clear(term);
-                            mpz_clear(cnt);
-                            mpz_clear(length);
-                            not_record_link_decrease(base);
-                            return NOT_PTR_ERROR;
-                        }
-                        item->reference = 1;
-
-                        mpz_clear(start);
-                        mpz_clear(stop);
-                        mpz_clear(step);
-                        mpz_clear(term);
-                        mpz_clear(cnt);
-                        mpz_clear(length);
-                        if (not_record_link_decrease(base) < 0)
-                        {
-                            return NOT_PTR_ERROR;
-                        }
-
-                        return item;
+                        not_record_link_decrease(item);
                     }
-                    mpz_add_ui(cnt, cnt, 1);
+                    return NOT_PTR_ERROR;
                 }
+
+                return item;
             }
         }
     }
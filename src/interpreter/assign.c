@@ -34,6 +34,111 @@
 #include "helper.h"
 #include "execute.h"
 
+/* frees what left holds so that it can take a value of another kind */
+static int32_t
+not_assign_release(not_node_t *node, not_record_t *left)
+{
+    if (left->kind == RECORD_KIND_INT)
+    {
+        mpz_clear(*(mpz_t *)(left->value));
+    }
+    else if (left->kind == RECORD_KIND_FLOAT)
+    {
+        mpf_clear(*(mpf_t *)(left->value));
+    }
+    else if (left->kind == RECORD_KIND_OBJECT)
+    {
+        return not_record_object_destroy((not_record_object_t *)left->value);
+    }
+    else if (left->kind == RECORD_KIND_TUPLE)
+    {
+        return not_record_tuple_destroy((not_record_tuple_t *)left->value);
+    }
+    else if (left->kind == RECORD_KIND_TYPE)
+    {
+        return not_record_type_destroy((not_record_type_t *)left->value);
+    }
+    else if (left->kind == RECORD_KIND_STRUCT)
+    {
+        return not_record_struct_destroy((not_record_struct_t *)left->value);
+    }
+    else if (left->kind == RECORD_KIND_PROC)
+    {
+        return not_record_proc_destroy((not_record_proc_t *)left->value);
+    }
+    else if (left->kind == RECORD_KIND_BUILTIN)
+    {
+        return not_record_builtin_destroy((not_record_builtin_t *)left->value);
+    }
+    else if (left->kind == RECORD_KIND_GENERATOR)
+    {
+        /* the last holder unwinds the suspended frame */
+        return not_generator_unlink(node, (not_record_generator_t *)left->value);
+    }
+
+    not_memory_free(left->value);
+    return 0;
+}
+
+/*
+ * Assigns through a copy of right for the kinds the ladder below has no
+ * branch for. left keeps its record, so everyone holding it sees the value.
+ * A generator cannot be copied, left shares it by a link instead.
+ */
+static int32_t
+not_assign_replace(not_node_t *node, not_record_t *left, not_record_t *right)
+{
+    if ((left->typed == 1) && (left->kind != right->kind))
+    {
+        not_error_type_by_node(node, "mismatch type: '%s' and '%s'",
+                               not_record_type_as_string(left), not_record_type_as_string(right));
+        return -1;
+    }
+
+    if (right->kind == RECORD_KIND_GENERATOR)
+    {
+        not_record_generator_t *generator = (not_record_generator_t *)right->value;
+        generator->link += 1;
+
+        if (not_assign_release(node, left) < 0)
+        {
+            generator->link -= 1;
+            return -1;
+        }
+
+        left->value = generator;
+        left->kind = RECORD_KIND_GENERATOR;
+
+        left->undefined = right->undefined;
+        left->nan = right->nan;
+        left->null = right->null;
+
+        return 0;
+    }
+
+    not_record_t *record_copy = not_record_copy(right);
+    if (record_copy == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    if (not_assign_release(node, left) < 0)
+    {
+        not_record_link_decrease(record_copy);
+        return -1;
+    }
+
+    left->value = record_copy->value;
+    left->kind = record_copy->kind;
+
+    left->undefined = right->undefined;
+    left->nan = right->nan;
+    left->null = right->null;
+
+    not_memory_free(record_copy);
+    return 0;
+}
+
 int32_t
 not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
 {
@@ -43,6 +148,21 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
         return -1;
     }
 
+    if ((left->kind == RECORD_KIND_STRING) && (left->reference == 1))
+    {
+        /* a string view borrows its buffer, it is resized below */
+        if (not_record_view_materialize(left) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if ((left->kind == RECORD_KIND_RANGE) || (right->kind == RECORD_KIND_RANGE) ||
+        (left->kind == RECORD_KIND_GENERATOR) || (right->kind == RECORD_KIND_GENERATOR))
+    {
+        return not_assign_replace(node, left, right);
+    }
+
     if (left->kind == RECORD_KIND_INT)
     {
         if (right->kind == RECORD_KIND_INT)
@@ -589,6 +709,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_INT;
@@ -619,6 +743,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_FLOAT;
@@ -659,6 +787,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_STRING;
@@ -687,6 +819,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_OBJECT;
@@ -744,6 +880,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_TYPE;
@@ -772,6 +912,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_STRUCT;
@@ -794,6 +938,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = NULL;
             left->kind = RECORD_KIND_NULL;
@@ -818,6 +966,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = NULL;
             left->kind = RECORD_KIND_UNDEFINED;
@@ -840,6 +992,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = NULL;
             left->kind = RECORD_KIND_NAN;
@@ -868,6 +1024,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_PROC;
@@ -896,6 +1056,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_BUILTIN;
@@ -1168,6 +1332,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_PROC;
@@ -1196,6 +1364,10 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
             {
                 not_memory_free(left->value);
             }
+            else if (not_record_view_detach(left) < 0)
+            {
+                return -1;
+            }
 
             left->value = ptr;
             left->kind = RECORD_KIND_BUILTIN;
@@ -4161,6 +4333,87 @@ not_assign_set_value(not_node_t *node, not_record_t *left, not_record_t *right)
     return 0;
 }
 
+/*
+ * Applies +, - or * straight to the target when both sides are plain values
+ * of the same kind, which is what assigning the computed result would leave
+ * behind, without building that result first. Returns 1 when applied and 0
+ * when the general path has to run.
+ */
+static int32_t
+not_assign_in_place(not_node_t *node, not_record_t *left, not_record_t *right)
+{
+    if (left->readonly || left->reference || left->null || left->undefined || left->nan)
+    {
+        return 0;
+    }
+
+    if (right->null || right->undefined || right->nan || (left->kind != right->kind))
+    {
+        return 0;
+    }
+
+    if (left->kind == RECORD_KIND_INT)
+    {
+        if (node->kind == NODE_KIND_ADD_ASSIGN)
+        {
+            mpz_add(*(mpz_t *)(left->value), *(mpz_t *)(left->value), *(mpz_t *)(right->value));
+            return 1;
+        }
+        else if (node->kind == NODE_KIND_SUB_ASSIGN)
+        {
+            mpz_sub(*(mpz_t *)(left->value), *(mpz_t *)(left->value), *(mpz_t *)(right->value));
+            return 1;
+        }
+        else if (node->kind == NODE_KIND_MUL_ASSIGN)
+        {
+            mpz_mul(*(mpz_t *)(left->value), *(mpz_t *)(left->value), *(mpz_t *)(right->value));
+            return 1;
+        }
+    }
+    else if (left->kind == RECORD_KIND_FLOAT)
+    {
+        if (node->kind == NODE_KIND_ADD_ASSIGN)
+        {
+            mpf_add(*(mpf_t *)(left->value), *(mpf_t *)(left->value), *(mpf_t *)(right->value));
+            return 1;
+        }
+        else if (node->kind == NODE_KIND_SUB_ASSIGN)
+        {
+            mpf_sub(*(mpf_t *)(left->value), *(mpf_t *)(left->value), *(mpf_t *)(right->value));
+            return 1;
+        }
+        else if (node->kind == NODE_KIND_MUL_ASSIGN)
+        {
+            mpf_mul(*(mpf_t *)(left->value), *(mpf_t *)(left->value), *(mpf_t *)(right->value));
+            return 1;
+        }
+    }
+    else if ((left->kind == RECORD_KIND_STRING) && (node->kind == NODE_KIND_ADD_ASSIGN))
+    {
+        /* the buffer moves, so nothing but the variable and this use may hold it */
+        if (left->link > 2)
+        {
+            return 0;
+        }
+
+        size_t length1 = strlen((char *)(left->value));
+        size_t length2 = strlen((char *)(right->value));
+
+        void *ptr = not_memory_realloc(left->value, length1 + length2 + 1);
+        if (ptr == NULL)
+        {
+            not_error_no_memory();
+            return -1;
+        }
+
+        memcpy((char *)(ptr) + length1, (char *)(right->value), length2 + 1);
+        left->value = ptr;
+        return 1;
+    }
+
+    return 0;
+}
+
 int32_t
 not_assign(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
@@ -4173,7 +4426,7 @@ not_assign(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node
             return -1;
         }
 
-        not_record_t *right = not_expression(binary->right, strip, applicant, origin);
+        not_record_t *right = not_primary_right_operand(binary->right, left, strip, applicant, origin);
         if (right == NOT_PTR_ERROR)
         {
             not_record_link_decrease(left);
@@ -4209,13 +4462,37 @@ not_assign(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node
             return -1;
         }
 
-        not_record_t *right = not_expression(binary->right, strip, applicant, origin);
+        not_record_t *right = not_primary_right_operand(binary->right, left, strip, applicant, origin);
         if (right == NOT_PTR_ERROR)
         {
             not_record_link_decrease(left);
             return -1;
         }
 
+        int32_t r1 = not_assign_in_place(node, left, right);
+        if (r1 < 0)
+        {
+            not_record_link_decrease(left);
+            not_record_link_decrease(right);
+
+            return -1;
+        }
+        else if (r1 == 1)
+        {
+            if (not_record_link_decrease(left) < 0)
+            {
+                not_record_link_decrease(right);
+                return -1;
+            }
+
+            if (not_record_link_decrease(right) < 0)
+            {
+                return -1;
+            }
+
+            return 0;
+        }
+
         not_record_t *result = not_addative_plus(node, left, right, applicant);
         if (result == NOT_PTR_ERROR)
         {
@@ -4257,13 +4534,37 @@ not_assign(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node
             return -1;
         }
 
-        not_record_t *right = not_expression(binary->right, strip, applicant, origin);
+        not_record_t *right = not_primary_right_operand(binary->right, left, strip, applicant, origin);
         if (right == NOT_PTR_ERROR)
         {
             not_record_link_decrease(left);
             return -1;
         }
 
+        int32_t r1 = not_assign_in_place(node, left, right);
+        if (r1 < 0)
+        {
+            not_record_link_decrease(left);
+            not_record_link_decrease(right);
+
+            return -1;
+        }
+        else if (r1 == 1)
+        {
+            if (not_record_link_decrease(left) < 0)
+            {
+                not_record_link_decrease(right);
+                return -1;
+            }
+
+            if (not_record_link_decrease(right) < 0)
+            {
+                return -1;
+            }
+
+            return 0;
+        }
+
         not_record_t *result = not_addative_minus(node, left, right, applicant);
         if (result == NOT_PTR_ERROR)
         {
@@ -4305,13 +4606,37 @@ not_assign(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node
             return -1;
         }
 
-        not_record_t *right = not_expression(binary->right, strip, applicant, origin);
+        not_record_t *right = not_primary_right_operand(binary->right, left, strip, applicant, origin);
         if (right == NOT_PTR_ERROR)
         {
             not_record_link_decrease(left);
             return -1;
         }
 
+        int32_t r1 = not_assign_in_place(node, left, right);
+        if (r1 < 0)
+        {
+            not_record_link_decrease(left);
+            not_record_link_decrease(right);
+
+            return -1;
+        }
+        else if (r1 == 1)
+        {
+            if (not_record_link_decrease(left) < 0)
+            {
+                not_record_link_decrease(right);
+                return -1;
+            }
+
+            if (not_record_link_decrease(right) < 0)
+            {
+                return -1;
+            }
+
+            return 0;
+        }
+
         not_record_t *result = not_multipicative_mul(node, left, right, applicant);
         if (result == NOT_PTR_ERROR)
         {
@@ -91,7 +91,7 @@ not_attribute_from_type(not_node_t *node, not_strip_t *strip, not_node_t *left,
 
                     if (property->type)
                     {
-                        not_record_t *record_type = not_expression(property->type, strip, applicant, NULL);
+                        not_record_t *record_type = not_execute_type_by_site(property->type, &property->check, strip, applicant);
                         if (record_type == NOT_PTR_ERROR)
                         {
                             not_record_link_decrease(record_value);
@@ -110,7 +110,7 @@ not_attribute_from_type(not_node_t *node, not_strip_t *strip, not_node_t *left,
                             return NOT_PTR_ERROR;
                         }
 
-                        int32_t r1 = not_execute_value_check_by_type(node, record_value, record_type);
+                        int32_t r1 = not_execute_value_check_by_site(node, &property->check, record_value, record_type);
                         if (r1 < 0)
                         {
                             not_record_link_decrease(record_type);
@@ -330,117 +330,402 @@ not_attribute_from_type(not_node_t *node, not_strip_t *strip, not_node_t *left,
     return NULL;
 }
 
-not_record_t *
-not_attribute_from_struct(not_node_t *node, not_strip_t *strip, not_node_t *left, not_node_t *right, not_node_t *applicant)
+#define NOT_ATTRIBUTE_CACHE_SIZE 4
+#define NOT_ATTRIBUTE_DEPTH 16
+
+/*
+ * A member as seen from an instance of a class. Inherited members are reached
+ * through heritage slots, path[k] is the slot taken at depth k, which has to
+ * hold heritages[k] with an instance of types[k].
+ */
+typedef struct not_attribute_member
 {
-    not_node_class_t *class1 = (not_node_class_t *)left->value;
-    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    not_node_t *key;
+    not_node_t *member;
+    not_node_t *owner;
+    uint64_t slot;
+    uint64_t depth;
+    uint64_t path[NOT_ATTRIBUTE_DEPTH];
+    not_node_t *heritages[NOT_ATTRIBUTE_DEPTH];
+    not_node_t *types[NOT_ATTRIBUTE_DEPTH];
+} not_attribute_member_t;
+
+/*
+ * Flattened member table of a class, own members first and then each heritage
+ * depth first, the first of a name wins as in a walk of the hierarchy. It is
+ * built once from an instance, so heritage types are guarded when used.
+ */
+typedef struct not_attribute_table
+{
+    uint64_t count;
+    int32_t complete;
+    not_attribute_member_t members[];
+} not_attribute_table_t;
+
+/*
+ * Per-site cache of an ATTRIBUTE node: for each class seen there, the table
+ * member the name resolved to, with access already checked.
+ */
+typedef struct not_attribute_cache
+{
+    size_t count;
+    struct
+    {
+        not_node_t *type;
+        not_attribute_member_t *member;
+    } entries[NOT_ATTRIBUTE_CACHE_SIZE];
+} not_attribute_cache_t;
+
+static int32_t
+not_attribute_cache_find(not_node_t *node, not_node_t *type, not_attribute_member_t **member)
+{
+    if (node->kind != NODE_KIND_ATTRIBUTE)
+    {
+        return 0;
+    }
+
+    not_node_attribute_t *attribute = (not_node_attribute_t *)node->value;
+    not_attribute_cache_t *cache = (not_attribute_cache_t *)attribute->cache;
+    if (cache == NULL)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < cache->count; i++)
+    {
+        if (cache->entries[i].type == type)
+        {
+            *member = cache->entries[i].member;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int32_t
+not_attribute_cache_push(not_node_t *node, not_node_t *type, not_attribute_member_t *member)
+{
+    if (node->kind != NODE_KIND_ATTRIBUTE)
+    {
+        return 0;
+    }
+
+    not_node_attribute_t *attribute = (not_node_attribute_t *)node->value;
+    not_attribute_cache_t *cache = (not_attribute_cache_t *)attribute->cache;
+    if (cache == NULL)
+    {
+        cache = (not_attribute_cache_t *)not_memory_calloc(1, sizeof(not_attribute_cache_t));
+        if (cache == NULL)
+        {
+            not_error_no_memory();
+            return -1;
+        }
+        attribute->cache = cache;
+    }
+
+    /* a megamorphic site keeps its first classes and resolves the rest slowly */
+    if (cache->count < NOT_ATTRIBUTE_CACHE_SIZE)
+    {
+        cache->entries[cache->count].type = type;
+        cache->entries[cache->count].member = member;
+        cache->count += 1;
+    }
+
+    return 0;
+}
+
+static int32_t
+not_attribute_member_key(not_node_t *item, not_node_t **key, uint64_t *flag)
+{
+    if (item->kind == NODE_KIND_PROPERTY)
+    {
+        not_node_property_t *property = (not_node_property_t *)item->value;
+        *key = property->key;
+        *flag = property->flag;
+        return 1;
+    }
+    else if (item->kind == NODE_KIND_CLASS)
+    {
+        not_node_class_t *class2 = (not_node_class_t *)item->value;
+        *key = class2->key;
+        *flag = class2->flag;
+        return 1;
+    }
+    else if (item->kind == NODE_KIND_FUN)
+    {
+        not_node_fun_t *fun1 = (not_node_fun_t *)item->value;
+        *key = fun1->key;
+        *flag = fun1->flag;
+        return 1;
+    }
+
+    return 0;
+}
+
+static uint64_t
+not_attribute_member_slot(not_node_t *type, not_node_t *member)
+{
+    if (member->kind != NODE_KIND_PROPERTY)
+    {
+        return UINT64_MAX;
+    }
+
+    not_node_property_t *property = (not_node_property_t *)member->value;
+    if ((property->flag & SYNTAX_MODIFIER_STATIC) == SYNTAX_MODIFIER_STATIC)
+    {
+        return UINT64_MAX;
+    }
+
+    /* same order as not_call_provide_class fills the instance */
+    not_node_class_t *class1 = (not_node_class_t *)type->value;
+
+    uint64_t slot = 0;
+    if (class1->heritages)
+    {
+        not_node_block_t *block = (not_node_block_t *)class1->heritages->value;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
+        {
+            slot += 1;
+        }
+    }
+
+    for (not_node_t *item = class1->block; item != member; item = item->next)
     {
         if (item->kind == NODE_KIND_PROPERTY)
         {
-            not_node_property_t *property = (not_node_property_t *)item->value;
-            if (not_helper_id_cmp(property->key, right) == 0)
+            not_node_property_t *property2 = (not_node_property_t *)item->value;
+            if ((property2->flag & SYNTAX_MODIFIER_STATIC) != SYNTAX_MODIFIER_STATIC)
             {
-                if (((property->flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT) || ((property->flag & SYNTAX_MODIFIER_STATIC) == SYNTAX_MODIFIER_STATIC))
-                {
-                    if ((property->flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT)
-                    {
-                        not_node_t *near = nearset_class(node);
-                        if (near && near->id == left->id)
-                        {
-                            goto success_property;
-                        }
-                    }
-                    not_node_basic_t *basic1 = (not_node_basic_t *)property->key->value;
-                    not_node_basic_t *basic2 = (not_node_basic_t *)class1->key->value;
-                    not_error_type_by_node(node, "'%s' unexpected access to '%s'",
-                                           basic2->value, basic1->value);
-                    return NOT_PTR_ERROR;
-                }
+                slot += 1;
+            }
+        }
+    }
 
-            success_property:
-                not_entry_t *entry = not_strip_variable_find(strip, left, property->key);
-                if (entry == NOT_PTR_ERROR)
-                {
-                    return NOT_PTR_ERROR;
-                }
-                else if (entry == NULL)
-                {
-                    not_node_basic_t *basic1 = (not_node_basic_t *)property->key->value;
-                    not_node_basic_t *basic2 = (not_node_basic_t *)class1->key->value;
-                    not_error_type_by_node(node, "in class '%s', property '%s' is not initialized",
-                                           basic2->value, basic1->value);
-                    return NOT_PTR_ERROR;
-                }
+    return slot;
+}
 
-                return entry->value;
+static not_record_struct_t *
+not_attribute_heritage_instance(not_strip_t *strip, not_node_t *type, uint64_t index, not_node_t *key)
+{
+    if (index >= strip->slots_count)
+    {
+        return NULL;
+    }
+
+    not_entry_t *entry = &strip->slots[index];
+    if ((entry->key != key) || (entry->scope != type) || (entry->value == NULL) || (entry->value->kind != RECORD_KIND_STRUCT))
+    {
+        return NULL;
+    }
+
+    return (not_record_struct_t *)entry->value->value;
+}
+
+static int32_t
+not_attribute_table_contain(not_attribute_table_t *table, not_node_t *key)
+{
+    for (uint64_t i = 0; i < table->count; i++)
+    {
+        if (not_helper_id_cmp(table->members[i].key, key) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static not_attribute_table_t *
+not_attribute_table(not_node_t *type, not_strip_t *strip)
+{
+    not_node_class_t *class1 = (not_node_class_t *)type->value;
+    if (class1->members)
+    {
+        return (not_attribute_table_t *)class1->members;
+    }
+
+    int32_t complete = 1;
+    uint64_t capacity = 0;
+
+    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    {
+        not_node_t *key = NULL;
+        uint64_t flag = 0;
+        capacity += not_attribute_member_key(item, &key, &flag);
+    }
+
+    if (class1->heritages)
+    {
+        not_node_block_t *block = (not_node_block_t *)class1->heritages->value;
+        uint64_t index = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next, index++)
+        {
+            not_node_heritage_t *heritage = (not_node_heritage_t *)item->value;
+            not_record_struct_t *record_struct = not_attribute_heritage_instance(strip, type, index, heritage->key);
+            if (record_struct == NULL)
+            {
+                complete = 0;
+                continue;
+            }
+
+            not_attribute_table_t *table = not_attribute_table(record_struct->type, (not_strip_t *)record_struct->value);
+            if (table == NOT_PTR_ERROR)
+            {
+                return NOT_PTR_ERROR;
             }
+
+            capacity += table->count;
+            complete = complete && table->complete;
         }
-        else if (item->kind == NODE_KIND_CLASS)
+    }
+
+    not_attribute_table_t *result = (not_attribute_table_t *)not_memory_calloc(1, sizeof(not_attribute_table_t) + capacity * sizeof(not_attribute_member_t));
+    if (result == NULL)
+    {
+        not_error_no_memory();
+        return NOT_PTR_ERROR;
+    }
+
+    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    {
+        not_node_t *key = NULL;
+        uint64_t flag = 0;
+        if (not_attribute_member_key(item, &key, &flag) && !not_attribute_table_contain(result, key))
         {
-            not_node_class_t *class2 = (not_node_class_t *)item->value;
-            if (not_helper_id_cmp(class2->key, right) == 0)
+            not_attribute_member_t *member = &result->members[result->count++];
+            member->key = key;
+            member->member = item;
+            member->owner = type;
+            member->slot = not_attribute_member_slot(type, item);
+            member->depth = 0;
+        }
+    }
+
+    if (class1->heritages)
+    {
+        not_node_block_t *block = (not_node_block_t *)class1->heritages->value;
+        uint64_t index = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next, index++)
+        {
+            not_node_heritage_t *heritage = (not_node_heritage_t *)item->value;
+            not_record_struct_t *record_struct = not_attribute_heritage_instance(strip, type, index, heritage->key);
+            if (record_struct == NULL)
             {
-                if (((class2->flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT) || ((class2->flag & SYNTAX_MODIFIER_STATIC) == SYNTAX_MODIFIER_STATIC))
-                {
-                    if ((class2->flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT)
-                    {
-                        not_node_t *near = nearset_class(node);
-                        if (near && near->id == left->id)
-                        {
-                            goto success_class;
-                        }
-                    }
+                continue;
+            }
 
-                    not_node_basic_t *basic1 = (not_node_basic_t *)class2->key->value;
-                    not_node_basic_t *basic2 = (not_node_basic_t *)class1->key->value;
-                    not_error_type_by_node(node, "'%s' unexpected access to '%s'",
-                                           basic2->value, basic1->value);
-                    return NOT_PTR_ERROR;
+            not_attribute_table_t *table = (not_attribute_table_t *)((not_node_class_t *)record_struct->type->value)->members;
+            for (uint64_t i = 0; i < table->count; i++)
+            {
+                not_attribute_member_t *inherited = &table->members[i];
+                if (inherited->depth + 1 > NOT_ATTRIBUTE_DEPTH)
+                {
+                    complete = 0;
+                    continue;
                 }
 
-            success_class:
-                not_strip_t *strip_copy = not_strip_copy(strip);
-                if (strip_copy == NOT_PTR_ERROR)
+                if (not_attribute_table_contain(result, inherited->key))
                 {
-                    return NOT_PTR_ERROR;
+                    continue;
                 }
 
-                return not_record_make_type(item, strip_copy);
+                not_attribute_member_t *member = &result->members[result->count++];
+                *member = *inherited;
+                member->depth = inherited->depth + 1;
+                member->path[0] = index;
+                member->heritages[0] = heritage->key;
+                member->types[0] = record_struct->type;
+                for (uint64_t k = 0; k < inherited->depth; k++)
+                {
+                    member->path[k + 1] = inherited->path[k];
+                    member->heritages[k + 1] = inherited->heritages[k];
+                    member->types[k + 1] = inherited->types[k];
+                }
             }
         }
-        else if (item->kind == NODE_KIND_FUN)
+    }
+
+    result->complete = complete;
+    class1->members = result;
+
+    return result;
+}
+
+static int32_t
+not_attribute_struct_access(not_node_t *node, not_node_t *left, not_node_t *key, uint64_t flag)
+{
+    if (((flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT) || ((flag & SYNTAX_MODIFIER_STATIC) == SYNTAX_MODIFIER_STATIC))
+    {
+        if ((flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT)
         {
-            not_node_fun_t *fun1 = (not_node_fun_t *)item->value;
-            if (not_helper_id_cmp(fun1->key, right) == 0)
+            not_node_t *near = nearset_class(node);
+            if (near && near->id == left->id)
             {
-                if (((fun1->flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT) || ((fun1->flag & SYNTAX_MODIFIER_STATIC) == SYNTAX_MODIFIER_STATIC))
-                {
-                    if ((fun1->flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT)
-                    {
-                        not_node_t *near = nearset_class(node);
-                        if (near && near->id == left->id)
-                        {
-                            goto success_fun;
-                        }
-                    }
+                return 0;
+            }
+        }
 
-                    not_node_basic_t *basic1 = (not_node_basic_t *)fun1->key->value;
-                    not_node_basic_t *basic2 = (not_node_basic_t *)class1->key->value;
-                    not_error_type_by_node(node, "'%s' unexpected access to '%s'",
-                                           basic2->value, basic1->value);
-                    return NOT_PTR_ERROR;
-                }
+        not_node_class_t *class1 = (not_node_class_t *)left->value;
+        not_node_basic_t *basic1 = (not_node_basic_t *)key->value;
+        not_node_basic_t *basic2 = (not_node_basic_t *)class1->key->value;
+        not_error_type_by_node(node, "'%s' unexpected access to '%s'",
+                               basic2->value, basic1->value);
+        return -1;
+    }
 
-            success_fun:
-                not_strip_t *strip_copy = not_strip_copy(strip);
-                if (strip_copy == NOT_PTR_ERROR)
-                {
-                    return NOT_PTR_ERROR;
-                }
+    return 0;
+}
 
-                return not_record_make_type(item, strip_copy);
+static not_record_t *
+not_attribute_from_member(not_node_t *node, not_strip_t *strip, not_node_t *left, not_node_t *member)
+{
+    if (member->kind == NODE_KIND_PROPERTY)
+    {
+        not_node_property_t *property = (not_node_property_t *)member->value;
+
+        not_entry_t *entry = not_strip_variable_find(strip, left, property->key);
+        if (entry == NOT_PTR_ERROR)
+        {
+            return NOT_PTR_ERROR;
+        }
+        else if (entry == NULL)
+        {
+            not_node_class_t *class1 = (not_node_class_t *)left->value;
+            not_node_basic_t *basic1 = (not_node_basic_t *)property->key->value;
+            not_node_basic_t *basic2 = (not_node_basic_t *)class1->key->value;
+            not_error_type_by_node(node, "in class '%s', property '%s' is not initialized",
+                                   basic2->value, basic1->value);
+            return NOT_PTR_ERROR;
+        }
+
+        return entry->value;
+    }
+
+    not_strip_t *strip_copy = not_strip_copy(strip);
+    if (strip_copy == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    return not_record_make_type(member, strip_copy);
+}
+
+static not_record_t *
+not_attribute_from_struct_by_walk(not_node_t *node, not_strip_t *strip, not_node_t *left, not_node_t *right, not_node_t *applicant)
+{
+    not_node_class_t *class1 = (not_node_class_t *)left->value;
+    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    {
+        not_node_t *key = NULL;
+        uint64_t flag = 0;
+        if (not_attribute_member_key(item, &key, &flag) && (not_helper_id_cmp(key, right) == 0))
+        {
+            if (not_attribute_struct_access(node, left, key, flag) < 0)
+            {
+                return NOT_PTR_ERROR;
             }
+
+            return not_attribute_from_member(node, strip, left, item);
         }
     }
 
@@ -468,7 +753,7 @@ not_attribute_from_struct(not_node_t *node, not_strip_t *strip, not_node_t *left
             not_record_struct_t *record_struct = (not_record_struct_t *)entry->value->value;
             not_node_t *type = record_struct->type;
 
-            not_record_t *result = not_attribute_from_struct(node, (not_strip_t *)record_struct->value, type, right, applicant);
+            not_record_t *result = not_attribute_from_struct_by_walk(node, (not_strip_t *)record_struct->value, type, right, applicant);
 
             if (result == NOT_PTR_ERROR)
             {
@@ -493,28 +778,96 @@ not_attribute_from_struct(not_node_t *node, not_strip_t *strip, not_node_t *left
 }
 
 not_record_t *
-not_attribute_object_builtin_remove(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+not_attribute_from_struct(not_node_t *node, not_strip_t *strip, not_node_t *left, not_node_t *right, not_node_t *applicant)
 {
-    if (arguments)
+    not_attribute_member_t *member = NULL;
+    if (not_attribute_cache_find(node, left, &member) == 0)
     {
-        not_node_block_t *block = (not_node_block_t *)arguments->value;
+        not_attribute_table_t *table = not_attribute_table(left, strip);
+        if (table == NOT_PTR_ERROR)
+        {
+            return NOT_PTR_ERROR;
+        }
 
-        uint64_t cnt1 = 0;
-        for (not_node_t *item = block->items; item != NULL; item = item->next)
+        for (uint64_t i = 0; i < table->count; i++)
         {
-            cnt1 += 1;
+            if (not_helper_id_cmp(table->members[i].key, right) == 0)
+            {
+                member = &table->members[i];
+                break;
+            }
         }
 
-        if (cnt1 > 1)
+        if (member == NULL)
+        {
+            return not_attribute_from_struct_by_walk(node, strip, left, right, applicant);
+        }
+
+        not_node_t *key = NULL;
+        uint64_t flag = 0;
+        not_attribute_member_key(member->member, &key, &flag);
+        if (not_attribute_struct_access(node, member->owner, key, flag) < 0)
+        {
+            return NOT_PTR_ERROR;
+        }
+
+        if (not_attribute_cache_push(node, left, member) < 0)
         {
-            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Remove", 1, cnt1);
             return NOT_PTR_ERROR;
         }
     }
-    else
+
+    not_strip_t *strip_owner = strip;
+    not_node_t *type = left;
+    for (uint64_t k = 0; k < member->depth; k++)
     {
-        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Remove", 1, 0);
-        return NOT_PTR_ERROR;
+        not_record_struct_t *record_struct = not_attribute_heritage_instance(strip_owner, type, member->path[k], member->heritages[k]);
+        if ((record_struct == NULL) || (record_struct->type != member->types[k]))
+        {
+            /* this instance inherits from other types than the one the table was built from */
+            return not_attribute_from_struct_by_walk(node, strip, left, right, applicant);
+        }
+
+        strip_owner = (not_strip_t *)record_struct->value;
+        type = record_struct->type;
+    }
+
+    if (member->slot < strip_owner->slots_count)
+    {
+        not_entry_t *entry = &strip_owner->slots[member->slot];
+        if ((entry->key == member->key) && (entry->scope == type))
+        {
+            not_record_link_increase(entry->value);
+            return entry->value;
+        }
+    }
+
+    return not_attribute_from_member(node, strip_owner, type, member->member);
+}
+
+not_record_t *
+not_attribute_object_builtin_remove(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+{
+    if (arguments)
+    {
+        not_node_block_t *block = (not_node_block_t *)arguments->value;
+
+        uint64_t cnt1 = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
+        {
+            cnt1 += 1;
+        }
+
+        if (cnt1 > 1)
+        {
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Remove", 1, cnt1);
+            return NOT_PTR_ERROR;
+        }
+    }
+    else
+    {
+        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Remove", 1, 0);
+        return NOT_PTR_ERROR;
     }
 
     not_record_t *return_value = NOT_PTR_ERROR;
@@ -757,6 +1110,12 @@ not_attribute_object_builtin_add(not_node_t *base, not_record_t *source, not_nod
         }
     }
 
+    /* the container writes to what it stores, so an interned value is copied */
+    if (not_record_unshare(&record_arg[1]) < 0)
+    {
+        goto region_cleanup;
+    }
+
     int found = 0;
     char *key = (char *)record_arg[0]->value;
     not_record_object_t *last_object = NULL;
@@ -1232,6 +1591,12 @@ not_attribute_tuple_builtin_set(not_node_t *base, not_record_t *source, not_node
         }
     }
 
+    /* the container writes to what it stores, so an interned value is copied */
+    if (not_record_unshare(&record_arg[1]) < 0)
+    {
+        goto region_cleanup;
+    }
+
     mpz_t length;
     mpz_init_set_si(length, 0);
     for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
@@ -1244,81 +1609,1365 @@ not_attribute_tuple_builtin_set(not_node_t *base, not_record_t *source, not_node
 
     while (mpz_cmp_si(term, 0) < 0)
     {
-        mpz_add(term, length, term);
-    }
+        mpz_add(term, length, term);
+    }
+
+    mpz_clear(length);
+
+    mpz_t index;
+    mpz_init_set_si(index, 0);
+
+    if (source->value == NULL)
+    {
+        not_record_t *arg = not_record_make_undefined();
+        if (arg == NOT_PTR_ERROR)
+        {
+            mpz_clear(term);
+            mpz_clear(index);
+            goto region_cleanup;
+        }
+
+        not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
+        if (new_tuple == NOT_PTR_ERROR)
+        {
+            mpz_clear(term);
+            mpz_clear(index);
+            not_record_link_decrease(arg);
+            goto region_cleanup;
+        }
+
+        source->value = new_tuple;
+    }
+
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    {
+        if (mpz_cmp(index, term) < 0)
+        {
+            if (tuple->next == NULL)
+            {
+                not_record_t *arg = not_record_make_undefined();
+                if (arg == NOT_PTR_ERROR)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    goto region_cleanup;
+                }
+
+                not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
+                if (new_tuple == NOT_PTR_ERROR)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    not_record_link_decrease(arg);
+                    goto region_cleanup;
+                }
+
+                tuple->next = new_tuple;
+            }
+            mpz_add_ui(index, index, 1);
+            continue;
+        }
+        else if (mpz_cmp(index, term) == 0)
+        {
+            if (not_record_link_decrease(tuple->value) < 0)
+            {
+                mpz_clear(term);
+                mpz_clear(index);
+                goto region_cleanup;
+            }
+
+            not_record_link_increase(record_arg[1]);
+            tuple->value = record_arg[1];
+            break;
+        }
+    }
+
+    mpz_clear(term);
+    mpz_clear(index);
+
+    not_record_link_increase(source);
+    return_value = source;
+
+region_cleanup:
+    for (size_t i = 0; i < array_length; i++)
+    {
+        if (record_arg[i])
+        {
+            if (not_record_link_decrease(record_arg[i]) < 0)
+            {
+                if (return_value != NOT_PTR_ERROR)
+                {
+                    not_record_link_decrease(return_value);
+                }
+                return NOT_PTR_ERROR;
+            }
+        }
+    }
+
+    return return_value;
+}
+
+not_record_t *
+not_attribute_tuple_builtin_insert(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+{
+    if (arguments)
+    {
+        not_node_block_t *block = (not_node_block_t *)arguments->value;
+
+        uint64_t cnt1 = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
+        {
+            cnt1 += 1;
+        }
+
+        if (cnt1 > 2)
+        {
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Insert", 2, cnt1);
+            return NOT_PTR_ERROR;
+        }
+    }
+    else
+    {
+        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Insert", 2, 0);
+        return NOT_PTR_ERROR;
+    }
+
+    not_record_t *return_value = NOT_PTR_ERROR;
+
+    not_node_block_t *block = (not_node_block_t *)arguments->value;
+    not_record_t *record_arg[2];
+
+    size_t array_length = sizeof(record_arg) / sizeof(record_arg[0]);
+    for (size_t i = 0; i < array_length; i++)
+    {
+        record_arg[i] = NULL;
+    }
+
+    size_t parameter_index = 0;
+    for (not_node_t *item = block->items; item != NULL; item = item->next)
+    {
+        not_node_argument_t *argument = (not_node_argument_t *)item->value;
+        if (argument->value)
+        {
+            if (not_helper_id_strcmp(argument->key, "index") == 0)
+            {
+                not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
+                if (arg == NOT_PTR_ERROR)
+                {
+                    goto region_cleanup;
+                }
+
+                if (arg->kind != RECORD_KIND_INT)
+                {
+                    not_node_basic_t *basic = (not_node_basic_t *)argument->key->value;
+                    not_error_type_by_node(argument->key, "'%s' mismatch: '%s' and '%s'",
+                                           basic->value, not_record_type_as_string(arg), "int");
+                }
+
+                record_arg[0] = arg;
+            }
+            else if (not_helper_id_strcmp(argument->key, "value") == 0)
+            {
+                not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
+                if (arg == NOT_PTR_ERROR)
+                {
+                    goto region_cleanup;
+                }
+
+                record_arg[1] = arg;
+            }
+        }
+        else
+        {
+            not_record_t *arg = not_expression(argument->key, strip, applicant, NULL);
+            if (arg == NOT_PTR_ERROR)
+            {
+                goto region_cleanup;
+            }
+
+            if (parameter_index == 0)
+            {
+                if (arg->kind != RECORD_KIND_INT)
+                {
+                    not_error_type_by_node(argument->key, "mismatch: '%s' and '%s'",
+                                           not_record_type_as_string(arg), "int");
+                }
+            }
+
+            record_arg[parameter_index] = arg;
+
+            parameter_index += 1;
+        }
+    }
+
+    for (size_t i = 0; i < array_length; i++)
+    {
+        if (record_arg[i] == NULL)
+        {
+            if (i == 0)
+            {
+                not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "Insert", "index");
+            }
+            else if (i == 1)
+            {
+                not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "Insert", "value");
+            }
+            goto region_cleanup;
+        }
+    }
+
+    /* the container writes to what it stores, so an interned value is copied */
+    if (not_record_unshare(&record_arg[1]) < 0)
+    {
+        goto region_cleanup;
+    }
+
+    mpz_t length;
+    mpz_init_set_si(length, 0);
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    {
+        mpz_add_ui(length, length, 1);
+    }
+
+    mpz_t term;
+    mpz_init_set(term, *(mpz_t *)record_arg[0]->value);
+
+    while (mpz_cmp_si(term, 0) < 0)
+    {
+        mpz_add(term, length, term);
+    }
+
+    mpz_clear(length);
+
+    int appended = 0;
+    mpz_t index;
+    mpz_init_set_si(index, 0);
+
+    if (source->value == NULL)
+    {
+        not_record_t *arg = not_record_make_undefined();
+        if (arg == NOT_PTR_ERROR)
+        {
+            mpz_clear(term);
+            mpz_clear(index);
+            goto region_cleanup;
+        }
+
+        not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
+        if (new_tuple == NOT_PTR_ERROR)
+        {
+            mpz_clear(term);
+            mpz_clear(index);
+            not_record_link_decrease(arg);
+            goto region_cleanup;
+        }
+
+        source->value = new_tuple;
+    }
+
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value, *previous = NULL; tuple != NULL; tuple = tuple->next)
+    {
+        if (mpz_cmp(index, term) < 0)
+        {
+            if (tuple->next == NULL)
+            {
+                not_record_t *arg = not_record_make_undefined();
+                if (arg == NOT_PTR_ERROR)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    goto region_cleanup;
+                }
+
+                not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
+                if (new_tuple == NOT_PTR_ERROR)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    not_record_link_decrease(arg);
+                    goto region_cleanup;
+                }
+
+                appended = 1;
+                tuple->next = new_tuple;
+            }
+            mpz_add_ui(index, index, 1);
+
+            previous = tuple;
+            continue;
+        }
+        else if (mpz_cmp(index, term) == 0)
+        {
+            if (appended == 1)
+            {
+                if (not_record_link_decrease(tuple->value) < 0)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    goto region_cleanup;
+                }
+
+                not_record_link_increase(record_arg[1]);
+                tuple->value = record_arg[1];
+            }
+            else
+            {
+                not_record_link_increase(record_arg[1]);
+                not_record_tuple_t *new_tuple = not_record_make_tuple(record_arg[1], NULL);
+                if (new_tuple == NOT_PTR_ERROR)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    not_record_link_decrease(record_arg[1]);
+                    goto region_cleanup;
+                }
+
+                if (previous)
+                {
+                    new_tuple->next = tuple;
+                    previous->next = new_tuple;
+                }
+                else
+                {
+                    new_tuple->next = tuple;
+                    source->value = new_tuple;
+                }
+            }
+            break;
+        }
+    }
+
+    mpz_clear(term);
+    mpz_clear(index);
+
+    not_record_link_increase(source);
+    return_value = source;
+
+region_cleanup:
+    for (size_t i = 0; i < array_length; i++)
+    {
+        if (record_arg[i])
+        {
+            if (not_record_link_decrease(record_arg[i]) < 0)
+            {
+                if (return_value != NOT_PTR_ERROR)
+                {
+                    not_record_link_decrease(return_value);
+                }
+                return NOT_PTR_ERROR;
+            }
+        }
+    }
+
+    return return_value;
+}
+
+not_record_t *
+not_attribute_tuple_builtin_append(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+{
+    if (arguments)
+    {
+        not_node_block_t *block = (not_node_block_t *)arguments->value;
+
+        uint64_t cnt1 = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
+        {
+            cnt1 += 1;
+        }
+
+        if (cnt1 > 1)
+        {
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Append", 1, cnt1);
+            return NOT_PTR_ERROR;
+        }
+    }
+    else
+    {
+        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Append", 1, 0);
+        return NOT_PTR_ERROR;
+    }
+
+    not_record_t *return_value = NOT_PTR_ERROR;
+
+    not_node_block_t *block = (not_node_block_t *)arguments->value;
+    not_record_t *record_arg[1];
+
+    size_t array_length = sizeof(record_arg) / sizeof(record_arg[0]);
+    for (size_t i = 0; i < array_length; i++)
+    {
+        record_arg[i] = NULL;
+    }
+
+    size_t parameter_index = 0;
+    for (not_node_t *item = block->items; item != NULL; item = item->next)
+    {
+        not_node_argument_t *argument = (not_node_argument_t *)item->value;
+        if (argument->value)
+        {
+            if (not_helper_id_strcmp(argument->key, "value") == 0)
+            {
+                not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
+                if (arg == NOT_PTR_ERROR)
+                {
+                    goto region_cleanup;
+                }
+
+                record_arg[0] = arg;
+            }
+        }
+        else
+        {
+            not_record_t *arg = not_expression(argument->key, strip, applicant, NULL);
+            if (arg == NOT_PTR_ERROR)
+            {
+                goto region_cleanup;
+            }
+
+            record_arg[parameter_index] = arg;
+
+            parameter_index += 1;
+        }
+    }
+
+    for (size_t i = 0; i < array_length; i++)
+    {
+        if (record_arg[i] == NULL)
+        {
+            if (i == 0)
+            {
+                not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "Append", "value");
+            }
+            goto region_cleanup;
+        }
+    }
+
+    /* the container writes to what it stores, so an interned value is copied */
+    if (not_record_unshare(&record_arg[0]) < 0)
+    {
+        goto region_cleanup;
+    }
+
+    mpz_t length;
+    mpz_init_set_si(length, 0);
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    {
+        mpz_add_ui(length, length, 1);
+    }
+
+    mpz_t term;
+    mpz_init_set(term, length);
+
+    mpz_clear(length);
+
+    int appended = 0;
+    mpz_t index;
+    mpz_init_set_si(index, 0);
+
+    if (source->value == NULL)
+    {
+        not_record_t *arg = not_record_make_undefined();
+        if (arg == NOT_PTR_ERROR)
+        {
+            mpz_clear(term);
+            mpz_clear(index);
+            goto region_cleanup;
+        }
+
+        not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
+        if (new_tuple == NOT_PTR_ERROR)
+        {
+            mpz_clear(term);
+            mpz_clear(index);
+            not_record_link_decrease(arg);
+            goto region_cleanup;
+        }
+
+        source->value = new_tuple;
+        appended = 1;
+    }
+
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value, *previous = NULL; tuple != NULL; tuple = tuple->next)
+    {
+        if (mpz_cmp(index, term) < 0)
+        {
+            if (tuple->next == NULL)
+            {
+                not_record_t *arg = not_record_make_undefined();
+                if (arg == NOT_PTR_ERROR)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    goto region_cleanup;
+                }
+
+                not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
+                if (new_tuple == NOT_PTR_ERROR)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    not_record_link_decrease(arg);
+                    goto region_cleanup;
+                }
+
+                appended = 1;
+                tuple->next = new_tuple;
+            }
+            mpz_add_ui(index, index, 1);
+
+            previous = tuple;
+            continue;
+        }
+        else if (mpz_cmp(index, term) == 0)
+        {
+            if (appended == 1)
+            {
+                if (not_record_link_decrease(tuple->value) < 0)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    goto region_cleanup;
+                }
+
+                not_record_link_increase(record_arg[0]);
+                tuple->value = record_arg[0];
+            }
+            else
+            {
+                not_record_link_increase(record_arg[0]);
+                not_record_tuple_t *new_tuple = not_record_make_tuple(record_arg[0], NULL);
+                if (new_tuple == NOT_PTR_ERROR)
+                {
+                    mpz_clear(term);
+                    mpz_clear(index);
+                    not_record_link_decrease(record_arg[0]);
+                    goto region_cleanup;
+                }
+
+                if (previous)
+                {
+                    new_tuple->next = tuple;
+                    previous->next = new_tuple;
+                }
+                else
+                {
+                    new_tuple->next = tuple;
+                    source->value = new_tuple;
+                }
+            }
+            break;
+        }
+    }
+
+    mpz_clear(term);
+    mpz_clear(index);
+
+    not_record_link_increase(source);
+    return_value = source;
+
+region_cleanup:
+    for (size_t i = 0; i < array_length; i++)
+    {
+        if (record_arg[i])
+        {
+            if (not_record_link_decrease(record_arg[i]) < 0)
+            {
+                if (return_value != NOT_PTR_ERROR)
+                {
+                    not_record_link_decrease(return_value);
+                }
+                return NOT_PTR_ERROR;
+            }
+        }
+    }
+
+    return return_value;
+}
+
+not_record_t *
+not_attribute_tuple_builtin_count(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+{
+    if (arguments)
+    {
+        not_node_block_t *block = (not_node_block_t *)arguments->value;
+
+        uint64_t cnt1 = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
+        {
+            cnt1 += 1;
+        }
+
+        if (cnt1 > 0)
+        {
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Count", 0, cnt1);
+            return NOT_PTR_ERROR;
+        }
+    }
+
+    not_record_t *return_value = NOT_PTR_ERROR;
+
+    mpz_t length;
+    mpz_init_set_si(length, 0);
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    {
+        mpz_add_ui(length, length, 1);
+    }
+
+    return_value = not_record_make_int_from_z(length);
+
+    mpz_clear(length);
+
+    return return_value;
+}
+
+#define NOT_ATTRIBUTE_SORT_MINRUN 32
+#define NOT_ATTRIBUTE_SORT_STACK 85
+#define NOT_ATTRIBUTE_SORT_PARALLEL 65536
+#define NOT_ATTRIBUTE_SORT_TASKS 8
+
+typedef struct not_attribute_sort_entry
+{
+    not_record_t *key;
+    not_record_t *value;
+} not_attribute_sort_entry_t;
+
+typedef struct not_attribute_sort
+{
+    int32_t (*less)(struct not_attribute_sort *, not_record_t *, not_record_t *);
+    not_node_t *base;
+    not_node_t *applicant;
+    int32_t reverse;
+} not_attribute_sort_t;
+
+typedef struct not_attribute_sort_task
+{
+    not_attribute_sort_t *sort;
+    not_attribute_sort_entry_t *entries;
+    not_attribute_sort_entry_t *buffer;
+    size_t lo;
+    size_t hi;
+    int32_t status;
+} not_attribute_sort_task_t;
+
+static int32_t
+not_attribute_sort_less_int(not_attribute_sort_t *sort, not_record_t *left, not_record_t *right)
+{
+    int32_t r1 = mpz_cmp(*(mpz_t *)left->value, *(mpz_t *)right->value);
+    return sort->reverse ? (r1 > 0) : (r1 < 0);
+}
+
+static int32_t
+not_attribute_sort_less_float(not_attribute_sort_t *sort, not_record_t *left, not_record_t *right)
+{
+    int32_t r1 = mpf_cmp(*(mpf_t *)left->value, *(mpf_t *)right->value);
+    return sort->reverse ? (r1 > 0) : (r1 < 0);
+}
+
+static int32_t
+not_attribute_sort_less_string(not_attribute_sort_t *sort, not_record_t *left, not_record_t *right)
+{
+    int32_t r1 = strcmp((char *)left->value, (char *)right->value);
+    return sort->reverse ? (r1 > 0) : (r1 < 0);
+}
+
+static int32_t
+not_attribute_sort_less_generic(not_attribute_sort_t *sort, not_record_t *left, not_record_t *right)
+{
+    not_record_t *result = sort->reverse ? not_relational_lt(sort->base, right, left, sort->applicant) : not_relational_lt(sort->base, left, right, sort->applicant);
+    if (result == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    int32_t r1 = not_execute_truthy(result);
+
+    if (not_record_link_decrease(result) < 0)
+    {
+        return -1;
+    }
+
+    return r1;
+}
+
+static int32_t
+not_attribute_sort_is_plain(not_record_t *record, uint64_t kind)
+{
+    return (record->kind == kind) && !record->null && !record->undefined && !record->nan;
+}
+
+/* a pair of plain ints, floats or strings is compared directly, anything else by '<' */
+static int32_t
+not_attribute_sort_less_any(not_attribute_sort_t *sort, not_record_t *left, not_record_t *right)
+{
+    if (not_attribute_sort_is_plain(left, RECORD_KIND_INT) && not_attribute_sort_is_plain(right, RECORD_KIND_INT))
+    {
+        return not_attribute_sort_less_int(sort, left, right);
+    }
+    else if (not_attribute_sort_is_plain(left, RECORD_KIND_FLOAT) && not_attribute_sort_is_plain(right, RECORD_KIND_FLOAT))
+    {
+        return not_attribute_sort_less_float(sort, left, right);
+    }
+    else if (not_attribute_sort_is_plain(left, RECORD_KIND_STRING) && not_attribute_sort_is_plain(right, RECORD_KIND_STRING))
+    {
+        return not_attribute_sort_less_string(sort, left, right);
+    }
+
+    return not_attribute_sort_less_generic(sort, left, right);
+}
+
+static void
+not_attribute_sort_select(not_attribute_sort_t *sort, not_attribute_sort_entry_t *entries, size_t count)
+{
+    uint64_t kinds[] = {RECORD_KIND_INT, RECORD_KIND_FLOAT, RECORD_KIND_STRING};
+    int32_t (*less[])(not_attribute_sort_t *, not_record_t *, not_record_t *) = {
+        not_attribute_sort_less_int, not_attribute_sort_less_float, not_attribute_sort_less_string};
+
+    sort->less = not_attribute_sort_less_generic;
+
+    for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++)
+    {
+        size_t i = 0;
+        for (; i < count; i++)
+        {
+            if (!not_attribute_sort_is_plain(entries[i].key, kinds[k]))
+            {
+                break;
+            }
+        }
+
+        if (i == count)
+        {
+            sort->less = less[k];
+            return;
+        }
+    }
+}
+
+static size_t
+not_attribute_sort_minrun(size_t count)
+{
+    size_t r = 0;
+    while (count >= NOT_ATTRIBUTE_SORT_MINRUN)
+    {
+        r |= count & 1;
+        count >>= 1;
+    }
+    return count + r;
+}
+
+static int32_t
+not_attribute_sort_insertion(not_attribute_sort_t *sort, not_attribute_sort_entry_t *entries, size_t lo, size_t start, size_t hi)
+{
+    for (size_t i = start; i < hi; i++)
+    {
+        not_attribute_sort_entry_t pivot = entries[i];
+
+        size_t left = lo, right = i;
+        while (left < right)
+        {
+            size_t middle = left + (right - left) / 2;
+            int32_t r1 = sort->less(sort, pivot.key, entries[middle].key);
+            if (r1 < 0)
+            {
+                return -1;
+            }
+            else if (r1)
+            {
+                right = middle;
+            }
+            else
+            {
+                left = middle + 1;
+            }
+        }
+
+        memmove(&entries[left + 1], &entries[left], (i - left) * sizeof(not_attribute_sort_entry_t));
+        entries[left] = pivot;
+    }
+
+    return 0;
+}
+
+static int32_t
+not_attribute_sort_run(not_attribute_sort_t *sort, not_attribute_sort_entry_t *entries, size_t lo, size_t hi, size_t *end)
+{
+    size_t run = lo + 1;
+    if (run == hi)
+    {
+        *end = hi;
+        return 0;
+    }
+
+    int32_t r1 = sort->less(sort, entries[run].key, entries[lo].key);
+    if (r1 < 0)
+    {
+        return -1;
+    }
+
+    int32_t descending = r1;
+    for (run += 1; run < hi; run++)
+    {
+        r1 = sort->less(sort, entries[run].key, entries[run - 1].key);
+        if (r1 < 0)
+        {
+            return -1;
+        }
+
+        if (r1 != descending)
+        {
+            break;
+        }
+    }
+
+    /* only strictly descending runs are reversed, so equal keys keep their order */
+    if (descending)
+    {
+        for (size_t i = lo, j = run - 1; i < j; i++, j--)
+        {
+            not_attribute_sort_entry_t temp = entries[i];
+            entries[i] = entries[j];
+            entries[j] = temp;
+        }
+    }
+
+    *end = run;
+    return 0;
+}
+
+static int32_t
+not_attribute_sort_merge(not_attribute_sort_t *sort, not_attribute_sort_entry_t *entries, not_attribute_sort_entry_t *buffer, size_t lo, size_t middle, size_t hi)
+{
+    int32_t r1 = sort->less(sort, entries[middle].key, entries[middle - 1].key);
+    if (r1 <= 0)
+    {
+        return r1;
+    }
+
+    memcpy(&buffer[lo], &entries[lo], (middle - lo) * sizeof(not_attribute_sort_entry_t));
+
+    size_t i = lo, j = middle, k = lo;
+    while ((i < middle) && (j < hi))
+    {
+        r1 = sort->less(sort, entries[j].key, buffer[i].key);
+        if (r1 < 0)
+        {
+            memcpy(&entries[k], &buffer[i], (middle - i) * sizeof(not_attribute_sort_entry_t));
+            return -1;
+        }
+
+        if (r1)
+        {
+            entries[k++] = entries[j++];
+        }
+        else
+        {
+            entries[k++] = buffer[i++];
+        }
+    }
+
+    memcpy(&entries[k], &buffer[i], (middle - i) * sizeof(not_attribute_sort_entry_t));
+    return 0;
+}
+
+static int32_t
+not_attribute_sort_range(not_attribute_sort_t *sort, not_attribute_sort_entry_t *entries, not_attribute_sort_entry_t *buffer, size_t lo, size_t hi)
+{
+    if (hi - lo < 2)
+    {
+        return 0;
+    }
+
+    size_t minrun = not_attribute_sort_minrun(hi - lo);
+
+    size_t stack_base[NOT_ATTRIBUTE_SORT_STACK];
+    size_t stack_length[NOT_ATTRIBUTE_SORT_STACK];
+    size_t stack_count = 0;
+
+    for (size_t start = lo; start < hi;)
+    {
+        size_t end = 0;
+        if (not_attribute_sort_run(sort, entries, start, hi, &end) < 0)
+        {
+            return -1;
+        }
+
+        if (end - start < minrun)
+        {
+            size_t force = (hi - start < minrun) ? hi : start + minrun;
+            if (not_attribute_sort_insertion(sort, entries, start, end, force) < 0)
+            {
+                return -1;
+            }
+            end = force;
+        }
+
+        stack_base[stack_count] = start;
+        stack_length[stack_count] = end - start;
+        stack_count += 1;
+        start = end;
+
+        /* keep run lengths growing like fibonacci so the stack stays logarithmic */
+        while (stack_count > 1)
+        {
+            size_t n = stack_count - 2;
+            if (((n > 0) && (stack_length[n - 1] <= stack_length[n] + stack_length[n + 1])) ||
+                ((n > 1) && (stack_length[n - 2] <= stack_length[n - 1] + stack_length[n])))
+            {
+                if (stack_length[n - 1] < stack_length[n + 1])
+                {
+                    n -= 1;
+                }
+            }
+            else if (stack_length[n] > stack_length[n + 1])
+            {
+                break;
+            }
+
+            if (not_attribute_sort_merge(sort, entries, buffer, stack_base[n], stack_base[n + 1], stack_base[n + 1] + stack_length[n + 1]) < 0)
+            {
+                return -1;
+            }
+
+            stack_length[n] += stack_length[n + 1];
+            for (size_t i = n + 1; i + 1 < stack_count; i++)
+            {
+                stack_base[i] = stack_base[i + 1];
+                stack_length[i] = stack_length[i + 1];
+            }
+            stack_count -= 1;
+        }
+    }
+
+    while (stack_count > 1)
+    {
+        size_t n = stack_count - 2;
+        if ((n > 0) && (stack_length[n - 1] < stack_length[n + 1]))
+        {
+            n -= 1;
+        }
+
+        if (not_attribute_sort_merge(sort, entries, buffer, stack_base[n], stack_base[n + 1], stack_base[n + 1] + stack_length[n + 1]) < 0)
+        {
+            return -1;
+        }
+
+        stack_length[n] += stack_length[n + 1];
+        for (size_t i = n + 1; i + 1 < stack_count; i++)
+        {
+            stack_base[i] = stack_base[i + 1];
+            stack_length[i] = stack_length[i + 1];
+        }
+        stack_count -= 1;
+    }
+
+    return 0;
+}
+
+#if defined(_WIN32) || defined(_WIN64)
+static DWORD WINAPI
+not_attribute_sort_worker(LPVOID arg)
+#else
+static void *
+not_attribute_sort_worker(void *arg)
+#endif
+{
+    not_attribute_sort_task_t *task = (not_attribute_sort_task_t *)arg;
+    task->status = not_attribute_sort_range(task->sort, task->entries, task->buffer, task->lo, task->hi);
+#if defined(_WIN32) || defined(_WIN64)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+static size_t
+not_attribute_sort_cores()
+{
+#if defined(_WIN32) || defined(_WIN64)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (size_t)info.dwNumberOfProcessors;
+#else
+    long r1 = sysconf(_SC_NPROCESSORS_ONLN);
+    return (r1 > 0) ? (size_t)r1 : 1;
+#endif
+}
+
+/*
+ * Chunks are sorted on worker threads and merged here. Only the direct
+ * comparators are used off the interpreter thread, '<' may run user code.
+ */
+static int32_t
+not_attribute_sort_parallel(not_attribute_sort_t *sort, not_attribute_sort_entry_t *entries, not_attribute_sort_entry_t *buffer, size_t count)
+{
+    size_t tasks_count = not_attribute_sort_cores();
+    if (tasks_count > NOT_ATTRIBUTE_SORT_TASKS)
+    {
+        tasks_count = NOT_ATTRIBUTE_SORT_TASKS;
+    }
+
+    if ((tasks_count < 2) || (count < NOT_ATTRIBUTE_SORT_PARALLEL) || (sort->less == not_attribute_sort_less_generic))
+    {
+        return not_attribute_sort_range(sort, entries, buffer, 0, count);
+    }
+
+    not_attribute_sort_task_t tasks[NOT_ATTRIBUTE_SORT_TASKS];
+#if defined(_WIN32) || defined(_WIN64)
+    HANDLE threads[NOT_ATTRIBUTE_SORT_TASKS];
+#else
+    pthread_t threads[NOT_ATTRIBUTE_SORT_TASKS];
+#endif
+    int32_t started[NOT_ATTRIBUTE_SORT_TASKS];
+
+    for (size_t i = 0; i < tasks_count; i++)
+    {
+        tasks[i].sort = sort;
+        tasks[i].entries = entries;
+        tasks[i].buffer = buffer;
+        tasks[i].lo = count * i / tasks_count;
+        tasks[i].hi = count * (i + 1) / tasks_count;
+        tasks[i].status = 0;
+
+#if defined(_WIN32) || defined(_WIN64)
+        threads[i] = CreateThread(NULL, 0, not_attribute_sort_worker, &tasks[i], 0, NULL);
+        started[i] = (threads[i] != NULL);
+#else
+        started[i] = (pthread_create(&threads[i], NULL, not_attribute_sort_worker, &tasks[i]) == 0);
+#endif
+        if (!started[i])
+        {
+            not_attribute_sort_worker(&tasks[i]);
+        }
+    }
+
+    int32_t status = 0;
+    for (size_t i = 0; i < tasks_count; i++)
+    {
+        if (started[i])
+        {
+#if defined(_WIN32) || defined(_WIN64)
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+
+        if (tasks[i].status < 0)
+        {
+            status = -1;
+        }
+    }
+
+    if (status < 0)
+    {
+        return -1;
+    }
+
+    for (size_t width = 1; width < tasks_count; width *= 2)
+    {
+        for (size_t i = 0; i + width < tasks_count; i += 2 * width)
+        {
+            size_t last = (i + 2 * width < tasks_count) ? i + 2 * width - 1 : tasks_count - 1;
+            if (not_attribute_sort_merge(sort, entries, buffer, tasks[i].lo, tasks[i + width].lo, tasks[last].hi) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* whether the tuple still holds exactly the values it had when the sort began */
+static int32_t
+not_attribute_sort_unchanged(not_record_t *source, not_record_t **values, size_t count)
+{
+    size_t index = 0;
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next, index++)
+    {
+        if ((index == count) || (tuple->value != values[index]))
+        {
+            return 0;
+        }
+    }
+
+    return index == count;
+}
+
+/*
+ * The key function and '<' may run user code that changes the tuple, so
+ * the values are held by links of their own while sorting, and the order
+ * is only written back when the tuple still holds the same values.
+ */
+static int32_t
+not_attribute_sort_tuple(not_node_t *base, not_record_t *source, not_record_t *key, int32_t reverse, int32_t parallel, not_strip_t *strip, not_node_t *applicant)
+{
+    size_t count = 0;
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    {
+        count += 1;
+    }
+
+    if (count < 2)
+    {
+        return 0;
+    }
+
+    not_record_t **values = (not_record_t **)not_memory_calloc(count, sizeof(not_record_t *));
+    if (values == NULL)
+    {
+        not_error_no_memory();
+        return -1;
+    }
+
+    not_attribute_sort_entry_t *entries = (not_attribute_sort_entry_t *)not_memory_calloc(count, sizeof(not_attribute_sort_entry_t));
+    if (entries == NULL)
+    {
+        not_error_no_memory();
+        not_memory_free(values);
+        return -1;
+    }
+
+    not_attribute_sort_entry_t *buffer = (not_attribute_sort_entry_t *)not_memory_calloc(count, sizeof(not_attribute_sort_entry_t));
+    if (buffer == NULL)
+    {
+        not_error_no_memory();
+        not_memory_free(entries);
+        not_memory_free(values);
+        return -1;
+    }
+
+    size_t index = 0;
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next, index++)
+    {
+        not_record_link_increase(tuple->value);
+        values[index] = tuple->value;
+        entries[index].value = tuple->value;
+        entries[index].key = tuple->value;
+    }
+
+    int32_t r1 = 0;
+    size_t keyed = 0;
+    if (key)
+    {
+        for (index = 0; index < count; index++)
+        {
+            not_record_t *record_key = not_call_by_one_arg(base, key, values[index], strip, applicant);
+            if (record_key == NOT_PTR_ERROR)
+            {
+                r1 = -1;
+                break;
+            }
+            entries[index].key = record_key;
+            keyed += 1;
+        }
+
+        if ((r1 == 0) && !not_attribute_sort_unchanged(source, values, count))
+        {
+            not_error_runtime_by_node(base, "'%s' modified during sort", "tuple");
+            r1 = -1;
+        }
+    }
+
+    if (r1 == 0)
+    {
+        not_attribute_sort_t sort;
+        sort.base = base;
+        sort.applicant = applicant;
+        sort.reverse = reverse;
+        not_attribute_sort_select(&sort, entries, count);
+
+        if (parallel)
+        {
+            r1 = not_attribute_sort_parallel(&sort, entries, buffer, count);
+        }
+        else
+        {
+            r1 = not_attribute_sort_range(&sort, entries, buffer, 0, count);
+        }
+
+        if ((r1 == 0) && (sort.less == not_attribute_sort_less_generic) && !not_attribute_sort_unchanged(source, values, count))
+        {
+            not_error_runtime_by_node(base, "'%s' modified during sort", "tuple");
+            r1 = -1;
+        }
+    }
+
+    /* the tuple keeps its links, only the order of its values changes */
+    if (r1 == 0)
+    {
+        index = 0;
+        for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; (tuple != NULL) && (index < count); tuple = tuple->next, index++)
+        {
+            tuple->value = entries[index].value;
+        }
+    }
+
+    /* either every key was made and sorted along, or the first ones are still in place */
+    for (size_t i = 0; i < keyed; i++)
+    {
+        if (not_record_link_decrease(entries[i].key) < 0)
+        {
+            r1 = -1;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (not_record_link_decrease(values[i]) < 0)
+        {
+            r1 = -1;
+        }
+    }
+
+    not_memory_free(buffer);
+    not_memory_free(entries);
+    not_memory_free(values);
+
+    return r1;
+}
+
+static not_record_tuple_t **
+not_attribute_heap_nodes(not_record_t *source, size_t *count)
+{
+    size_t length = 0;
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    {
+        length += 1;
+    }
+
+    not_record_tuple_t **nodes = (not_record_tuple_t **)not_memory_calloc(length + 1, sizeof(not_record_tuple_t *));
+    if (nodes == NULL)
+    {
+        not_error_no_memory();
+        return NOT_PTR_ERROR;
+    }
+
+    size_t index = 0;
+    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    {
+        nodes[index++] = tuple;
+    }
+
+    *count = length;
+    return nodes;
+}
+
+static int32_t
+not_attribute_heap_sift_down(not_attribute_sort_t *sort, not_record_tuple_t **nodes, size_t count)
+{
+    size_t i = 0;
+    while (1)
+    {
+        size_t smallest = i;
+        for (size_t child = 2 * i + 1; (child <= 2 * i + 2) && (child < count); child++)
+        {
+            int32_t r1 = sort->less(sort, nodes[child]->value, nodes[smallest]->value);
+            if (r1 < 0)
+            {
+                return -1;
+            }
+            else if (r1)
+            {
+                smallest = child;
+            }
+        }
 
-    mpz_clear(length);
+        if (smallest == i)
+        {
+            return 0;
+        }
 
-    mpz_t index;
-    mpz_init_set_si(index, 0);
+        not_record_t *temp = nodes[i]->value;
+        nodes[i]->value = nodes[smallest]->value;
+        nodes[smallest]->value = temp;
+        i = smallest;
+    }
+}
 
-    if (source->value == NULL)
+not_record_t *
+not_attribute_tuple_builtin_sort(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+{
+    if (arguments)
     {
-        not_record_t *arg = not_record_make_undefined();
-        if (arg == NOT_PTR_ERROR)
+        not_node_block_t *block = (not_node_block_t *)arguments->value;
+
+        uint64_t cnt1 = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
         {
-            mpz_clear(term);
-            mpz_clear(index);
-            goto region_cleanup;
+            cnt1 += 1;
         }
 
-        not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
-        if (new_tuple == NOT_PTR_ERROR)
+        if (cnt1 > 2)
         {
-            mpz_clear(term);
-            mpz_clear(index);
-            not_record_link_decrease(arg);
-            goto region_cleanup;
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Sort", 2, cnt1);
+            return NOT_PTR_ERROR;
         }
+    }
 
-        source->value = new_tuple;
+    not_record_t *return_value = NOT_PTR_ERROR;
+
+    not_record_t *record_arg[2];
+
+    size_t array_length = sizeof(record_arg) / sizeof(record_arg[0]);
+    for (size_t i = 0; i < array_length; i++)
+    {
+        record_arg[i] = NULL;
     }
 
-    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    if (arguments)
     {
-        if (mpz_cmp(index, term) < 0)
+        not_node_block_t *block = (not_node_block_t *)arguments->value;
+
+        size_t parameter_index = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
         {
-            if (tuple->next == NULL)
+            not_node_argument_t *argument = (not_node_argument_t *)item->value;
+            if (argument->value)
             {
-                not_record_t *arg = not_record_make_undefined();
-                if (arg == NOT_PTR_ERROR)
+                if (not_helper_id_strcmp(argument->key, "reverse") == 0)
                 {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    goto region_cleanup;
+                    not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
+                    if (arg == NOT_PTR_ERROR)
+                    {
+                        goto region_cleanup;
+                    }
+
+                    record_arg[0] = arg;
                 }
+                else if (not_helper_id_strcmp(argument->key, "parallel") == 0)
+                {
+                    not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
+                    if (arg == NOT_PTR_ERROR)
+                    {
+                        goto region_cleanup;
+                    }
 
-                not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
-                if (new_tuple == NOT_PTR_ERROR)
+                    record_arg[1] = arg;
+                }
+            }
+            else
+            {
+                not_record_t *arg = not_expression(argument->key, strip, applicant, NULL);
+                if (arg == NOT_PTR_ERROR)
                 {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    not_record_link_decrease(arg);
                     goto region_cleanup;
                 }
 
-                tuple->next = new_tuple;
-            }
-            mpz_add_ui(index, index, 1);
-            continue;
-        }
-        else if (mpz_cmp(index, term) == 0)
-        {
-            if (not_record_link_decrease(tuple->value) < 0)
-            {
-                mpz_clear(term);
-                mpz_clear(index);
-                goto region_cleanup;
-            }
+                record_arg[parameter_index] = arg;
 
-            not_record_link_increase(record_arg[1]);
-            tuple->value = record_arg[1];
-            break;
+                parameter_index += 1;
+            }
         }
     }
 
-    mpz_clear(term);
-    mpz_clear(index);
+    int32_t reverse = record_arg[0] ? not_execute_truthy(record_arg[0]) : 0;
+    int32_t parallel = record_arg[1] ? not_execute_truthy(record_arg[1]) : 0;
+
+    if (not_attribute_sort_tuple(base, source, NULL, reverse, parallel, strip, applicant) < 0)
+    {
+        goto region_cleanup;
+    }
 
     not_record_link_increase(source);
     return_value = source;
@@ -1343,7 +2992,7 @@ region_cleanup:
 }
 
 not_record_t *
-not_attribute_tuple_builtin_insert(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+not_attribute_tuple_builtin_sort_by(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
 {
     if (arguments)
     {
@@ -1355,22 +3004,22 @@ not_attribute_tuple_builtin_insert(not_node_t *base, not_record_t *source, not_n
             cnt1 += 1;
         }
 
-        if (cnt1 > 2)
+        if (cnt1 > 3)
         {
-            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Insert", 2, cnt1);
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "SortBy", 3, cnt1);
             return NOT_PTR_ERROR;
         }
     }
     else
     {
-        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Insert", 2, 0);
+        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "SortBy", 3, 0);
         return NOT_PTR_ERROR;
     }
 
     not_record_t *return_value = NOT_PTR_ERROR;
 
     not_node_block_t *block = (not_node_block_t *)arguments->value;
-    not_record_t *record_arg[2];
+    not_record_t *record_arg[3];
 
     size_t array_length = sizeof(record_arg) / sizeof(record_arg[0]);
     for (size_t i = 0; i < array_length; i++)
@@ -1384,7 +3033,7 @@ not_attribute_tuple_builtin_insert(not_node_t *base, not_record_t *source, not_n
         not_node_argument_t *argument = (not_node_argument_t *)item->value;
         if (argument->value)
         {
-            if (not_helper_id_strcmp(argument->key, "index") == 0)
+            if (not_helper_id_strcmp(argument->key, "key") == 0)
             {
                 not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
                 if (arg == NOT_PTR_ERROR)
@@ -1392,16 +3041,19 @@ not_attribute_tuple_builtin_insert(not_node_t *base, not_record_t *source, not_n
                     goto region_cleanup;
                 }
 
-                if (arg->kind != RECORD_KIND_INT)
+                record_arg[0] = arg;
+            }
+            else if (not_helper_id_strcmp(argument->key, "reverse") == 0)
+            {
+                not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
+                if (arg == NOT_PTR_ERROR)
                 {
-                    not_node_basic_t *basic = (not_node_basic_t *)argument->key->value;
-                    not_error_type_by_node(argument->key, "'%s' mismatch: '%s' and '%s'",
-                                           basic->value, not_record_type_as_string(arg), "int");
+                    goto region_cleanup;
                 }
 
-                record_arg[0] = arg;
+                record_arg[1] = arg;
             }
-            else if (not_helper_id_strcmp(argument->key, "value") == 0)
+            else if (not_helper_id_strcmp(argument->key, "parallel") == 0)
             {
                 not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
                 if (arg == NOT_PTR_ERROR)
@@ -1409,7 +3061,7 @@ not_attribute_tuple_builtin_insert(not_node_t *base, not_record_t *source, not_n
                     goto region_cleanup;
                 }
 
-                record_arg[1] = arg;
+                record_arg[2] = arg;
             }
         }
         else
@@ -1420,157 +3072,173 @@ not_attribute_tuple_builtin_insert(not_node_t *base, not_record_t *source, not_n
                 goto region_cleanup;
             }
 
-            if (parameter_index == 0)
-            {
-                if (arg->kind != RECORD_KIND_INT)
-                {
-                    not_error_type_by_node(argument->key, "mismatch: '%s' and '%s'",
-                                           not_record_type_as_string(arg), "int");
-                }
-            }
-
             record_arg[parameter_index] = arg;
 
             parameter_index += 1;
         }
     }
 
-    for (size_t i = 0; i < array_length; i++)
+    if (record_arg[0] == NULL)
     {
-        if (record_arg[i] == NULL)
-        {
-            if (i == 0)
-            {
-                not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "Insert", "index");
-            }
-            else if (i == 1)
-            {
-                not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "Insert", "value");
-            }
-            goto region_cleanup;
-        }
+        not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "SortBy", "key");
+        goto region_cleanup;
     }
 
-    mpz_t length;
-    mpz_init_set_si(length, 0);
-    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    int32_t reverse = record_arg[1] ? not_execute_truthy(record_arg[1]) : 0;
+    int32_t parallel = record_arg[2] ? not_execute_truthy(record_arg[2]) : 0;
+
+    if (not_attribute_sort_tuple(base, source, record_arg[0], reverse, parallel, strip, applicant) < 0)
     {
-        mpz_add_ui(length, length, 1);
+        goto region_cleanup;
     }
 
-    mpz_t term;
-    mpz_init_set(term, *(mpz_t *)record_arg[0]->value);
+    not_record_link_increase(source);
+    return_value = source;
 
-    while (mpz_cmp_si(term, 0) < 0)
+region_cleanup:
+    for (size_t i = 0; i < array_length; i++)
     {
-        mpz_add(term, length, term);
+        if (record_arg[i])
+        {
+            if (not_record_link_decrease(record_arg[i]) < 0)
+            {
+                if (return_value != NOT_PTR_ERROR)
+                {
+                    not_record_link_decrease(return_value);
+                }
+                return NOT_PTR_ERROR;
+            }
+        }
     }
 
-    mpz_clear(length);
-
-    int appended = 0;
-    mpz_t index;
-    mpz_init_set_si(index, 0);
+    return return_value;
+}
 
-    if (source->value == NULL)
+not_record_t *
+not_attribute_tuple_builtin_binary_search(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+{
+    if (arguments)
     {
-        not_record_t *arg = not_record_make_undefined();
-        if (arg == NOT_PTR_ERROR)
+        not_node_block_t *block = (not_node_block_t *)arguments->value;
+
+        uint64_t cnt1 = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
         {
-            mpz_clear(term);
-            mpz_clear(index);
-            goto region_cleanup;
+            cnt1 += 1;
         }
 
-        not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
-        if (new_tuple == NOT_PTR_ERROR)
+        if (cnt1 > 1)
         {
-            mpz_clear(term);
-            mpz_clear(index);
-            not_record_link_decrease(arg);
-            goto region_cleanup;
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "BinarySearch", 1, cnt1);
+            return NOT_PTR_ERROR;
         }
-
-        source->value = new_tuple;
     }
-
-    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value, *previous = NULL; tuple != NULL; tuple = tuple->next)
+    else
     {
-        if (mpz_cmp(index, term) < 0)
-        {
-            if (tuple->next == NULL)
-            {
-                not_record_t *arg = not_record_make_undefined();
-                if (arg == NOT_PTR_ERROR)
-                {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    goto region_cleanup;
-                }
+        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "BinarySearch", 1, 0);
+        return NOT_PTR_ERROR;
+    }
 
-                not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
-                if (new_tuple == NOT_PTR_ERROR)
-                {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    not_record_link_decrease(arg);
-                    goto region_cleanup;
-                }
+    not_record_t *return_value = NOT_PTR_ERROR;
 
-                appended = 1;
-                tuple->next = new_tuple;
-            }
-            mpz_add_ui(index, index, 1);
+    not_node_block_t *block = (not_node_block_t *)arguments->value;
+    not_record_t *record_arg[1];
 
-            previous = tuple;
-            continue;
-        }
-        else if (mpz_cmp(index, term) == 0)
-        {
-            if (appended == 1)
-            {
-                if (not_record_link_decrease(tuple->value) < 0)
-                {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    goto region_cleanup;
-                }
+    size_t array_length = sizeof(record_arg) / sizeof(record_arg[0]);
+    for (size_t i = 0; i < array_length; i++)
+    {
+        record_arg[i] = NULL;
+    }
 
-                not_record_link_increase(record_arg[1]);
-                tuple->value = record_arg[1];
-            }
-            else
+    size_t parameter_index = 0;
+    for (not_node_t *item = block->items; item != NULL; item = item->next)
+    {
+        not_node_argument_t *argument = (not_node_argument_t *)item->value;
+        if (argument->value)
+        {
+            if (not_helper_id_strcmp(argument->key, "value") == 0)
             {
-                not_record_link_increase(record_arg[1]);
-                not_record_tuple_t *new_tuple = not_record_make_tuple(record_arg[1], NULL);
-                if (new_tuple == NOT_PTR_ERROR)
+                not_record_t *arg = not_expression(argument->value, strip, applicant, NULL);
+                if (arg == NOT_PTR_ERROR)
                 {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    not_record_link_decrease(record_arg[1]);
                     goto region_cleanup;
                 }
 
-                if (previous)
-                {
-                    new_tuple->next = tuple;
-                    previous->next = new_tuple;
-                }
-                else
-                {
-                    new_tuple->next = tuple;
-                    source->value = new_tuple;
-                }
+                record_arg[0] = arg;
             }
-            break;
+        }
+        else
+        {
+            not_record_t *arg = not_expression(argument->key, strip, applicant, NULL);
+            if (arg == NOT_PTR_ERROR)
+            {
+                goto region_cleanup;
+            }
+
+            record_arg[parameter_index] = arg;
+
+            parameter_index += 1;
         }
     }
 
-    mpz_clear(term);
-    mpz_clear(index);
+    if (record_arg[0] == NULL)
+    {
+        not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "BinarySearch", "value");
+        goto region_cleanup;
+    }
 
-    not_record_link_increase(source);
-    return_value = source;
+    size_t count = 0;
+    not_record_tuple_t **nodes = not_attribute_heap_nodes(source, &count);
+    if (nodes == NOT_PTR_ERROR)
+    {
+        goto region_cleanup;
+    }
+
+    not_attribute_sort_t sort;
+    sort.base = base;
+    sort.applicant = applicant;
+    sort.reverse = 0;
+    sort.less = not_attribute_sort_less_any;
+
+    /* leftmost position whose value is not less than the one searched for */
+    size_t left = 0, right = count;
+    while (left < right)
+    {
+        size_t middle = left + (right - left) / 2;
+        int32_t r1 = sort.less(&sort, nodes[middle]->value, record_arg[0]);
+        if (r1 < 0)
+        {
+            not_memory_free(nodes);
+            goto region_cleanup;
+        }
+        else if (r1)
+        {
+            left = middle + 1;
+        }
+        else
+        {
+            right = middle;
+        }
+    }
+
+    int64_t position = -1;
+    if (left < count)
+    {
+        int32_t r1 = sort.less(&sort, record_arg[0], nodes[left]->value);
+        if (r1 < 0)
+        {
+            not_memory_free(nodes);
+            goto region_cleanup;
+        }
+        else if (r1 == 0)
+        {
+            position = (int64_t)left;
+        }
+    }
+
+    not_memory_free(nodes);
+
+    return_value = not_record_make_int_from_si(position);
 
 region_cleanup:
     for (size_t i = 0; i < array_length; i++)
@@ -1592,7 +3260,7 @@ region_cleanup:
 }
 
 not_record_t *
-not_attribute_tuple_builtin_append(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+not_attribute_tuple_builtin_heap_push(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
 {
     if (arguments)
     {
@@ -1606,13 +3274,13 @@ not_attribute_tuple_builtin_append(not_node_t *base, not_record_t *source, not_n
 
         if (cnt1 > 1)
         {
-            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Append", 1, cnt1);
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "HeapPush", 1, cnt1);
             return NOT_PTR_ERROR;
         }
     }
     else
     {
-        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Append", 1, 0);
+        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "HeapPush", 1, 0);
         return NOT_PTR_ERROR;
     }
 
@@ -1658,131 +3326,69 @@ not_attribute_tuple_builtin_append(not_node_t *base, not_record_t *source, not_n
         }
     }
 
-    for (size_t i = 0; i < array_length; i++)
+    if (record_arg[0] == NULL)
     {
-        if (record_arg[i] == NULL)
-        {
-            if (i == 0)
-            {
-                not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "Append", "value");
-            }
-            goto region_cleanup;
-        }
+        not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "HeapPush", "value");
+        goto region_cleanup;
     }
 
-    mpz_t length;
-    mpz_init_set_si(length, 0);
-    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    not_record_link_increase(record_arg[0]);
+    not_record_tuple_t *new_tuple = not_record_make_tuple(record_arg[0], NULL);
+    if (new_tuple == NOT_PTR_ERROR)
     {
-        mpz_add_ui(length, length, 1);
+        not_record_link_decrease(record_arg[0]);
+        goto region_cleanup;
     }
 
-    mpz_t term;
-    mpz_init_set(term, length);
-
-    mpz_clear(length);
-
-    int appended = 0;
-    mpz_t index;
-    mpz_init_set_si(index, 0);
-
-    if (source->value == NULL)
+    not_record_tuple_t *last = (not_record_tuple_t *)source->value;
+    while (last && last->next)
     {
-        not_record_t *arg = not_record_make_undefined();
-        if (arg == NOT_PTR_ERROR)
-        {
-            mpz_clear(term);
-            mpz_clear(index);
-            goto region_cleanup;
-        }
-
-        not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
-        if (new_tuple == NOT_PTR_ERROR)
-        {
-            mpz_clear(term);
-            mpz_clear(index);
-            not_record_link_decrease(arg);
-            goto region_cleanup;
-        }
+        last = last->next;
+    }
 
+    if (last)
+    {
+        last->next = new_tuple;
+    }
+    else
+    {
         source->value = new_tuple;
-        appended = 1;
     }
 
-    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value, *previous = NULL; tuple != NULL; tuple = tuple->next)
+    size_t count = 0;
+    not_record_tuple_t **nodes = not_attribute_heap_nodes(source, &count);
+    if (nodes == NOT_PTR_ERROR)
     {
-        if (mpz_cmp(index, term) < 0)
-        {
-            if (tuple->next == NULL)
-            {
-                not_record_t *arg = not_record_make_undefined();
-                if (arg == NOT_PTR_ERROR)
-                {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    goto region_cleanup;
-                }
-
-                not_record_tuple_t *new_tuple = not_record_make_tuple(arg, NULL);
-                if (new_tuple == NOT_PTR_ERROR)
-                {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    not_record_link_decrease(arg);
-                    goto region_cleanup;
-                }
+        goto region_cleanup;
+    }
 
-                appended = 1;
-                tuple->next = new_tuple;
-            }
-            mpz_add_ui(index, index, 1);
+    not_attribute_sort_t sort;
+    sort.base = base;
+    sort.applicant = applicant;
+    sort.reverse = 0;
+    sort.less = not_attribute_sort_less_any;
 
-            previous = tuple;
-            continue;
+    for (size_t i = count - 1; i > 0;)
+    {
+        size_t parent = (i - 1) / 2;
+        int32_t r1 = sort.less(&sort, nodes[i]->value, nodes[parent]->value);
+        if (r1 < 0)
+        {
+            not_memory_free(nodes);
+            goto region_cleanup;
         }
-        else if (mpz_cmp(index, term) == 0)
+        else if (r1 == 0)
         {
-            if (appended == 1)
-            {
-                if (not_record_link_decrease(tuple->value) < 0)
-                {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    goto region_cleanup;
-                }
-
-                not_record_link_increase(record_arg[0]);
-                tuple->value = record_arg[0];
-            }
-            else
-            {
-                not_record_link_increase(record_arg[0]);
-                not_record_tuple_t *new_tuple = not_record_make_tuple(record_arg[0], NULL);
-                if (new_tuple == NOT_PTR_ERROR)
-                {
-                    mpz_clear(term);
-                    mpz_clear(index);
-                    not_record_link_decrease(record_arg[0]);
-                    goto region_cleanup;
-                }
-
-                if (previous)
-                {
-                    new_tuple->next = tuple;
-                    previous->next = new_tuple;
-                }
-                else
-                {
-                    new_tuple->next = tuple;
-                    source->value = new_tuple;
-                }
-            }
             break;
         }
+
+        not_record_t *temp = nodes[i]->value;
+        nodes[i]->value = nodes[parent]->value;
+        nodes[parent]->value = temp;
+        i = parent;
     }
 
-    mpz_clear(term);
-    mpz_clear(index);
+    not_memory_free(nodes);
 
     not_record_link_increase(source);
     return_value = source;
@@ -1807,7 +3413,7 @@ region_cleanup:
 }
 
 not_record_t *
-not_attribute_tuple_builtin_count(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+not_attribute_tuple_builtin_heap_pop(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
 {
     if (arguments)
     {
@@ -1821,23 +3427,53 @@ not_attribute_tuple_builtin_count(not_node_t *base, not_record_t *source, not_no
 
         if (cnt1 > 0)
         {
-            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Count", 0, cnt1);
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "HeapPop", 0, cnt1);
             return NOT_PTR_ERROR;
         }
     }
 
-    not_record_t *return_value = NOT_PTR_ERROR;
+    size_t count = 0;
+    not_record_tuple_t **nodes = not_attribute_heap_nodes(source, &count);
+    if (nodes == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
 
-    mpz_t length;
-    mpz_init_set_si(length, 0);
-    for (not_record_tuple_t *tuple = (not_record_tuple_t *)source->value; tuple != NULL; tuple = tuple->next)
+    if (count == 0)
     {
-        mpz_add_ui(length, length, 1);
+        not_error_type_by_node(base, "'%s' from an empty tuple", "HeapPop");
+        not_memory_free(nodes);
+        return NOT_PTR_ERROR;
     }
 
-    return_value = not_record_make_int_from_z(length);
+    /* the popped value takes over the link the tuple held */
+    not_record_t *return_value = nodes[0]->value;
+    nodes[0]->value = nodes[count - 1]->value;
 
-    mpz_clear(length);
+    if (count > 1)
+    {
+        nodes[count - 2]->next = NULL;
+    }
+    else
+    {
+        source->value = NULL;
+    }
+    not_memory_free(nodes[count - 1]);
+
+    not_attribute_sort_t sort;
+    sort.base = base;
+    sort.applicant = applicant;
+    sort.reverse = 0;
+    sort.less = not_attribute_sort_less_any;
+
+    if (not_attribute_heap_sift_down(&sort, nodes, count - 1) < 0)
+    {
+        not_memory_free(nodes);
+        not_record_link_decrease(return_value);
+        return NOT_PTR_ERROR;
+    }
+
+    not_memory_free(nodes);
 
     return return_value;
 }
@@ -2355,7 +3991,7 @@ region_finalize:
 not_record_t *
 not_attribute(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
-    not_node_binary_t *binary = (not_node_binary_t *)node->value;
+    not_node_attribute_t *binary = (not_node_attribute_t *)node->value;
 
     not_record_t *left = not_expression(binary->left, strip, applicant, origin);
     if (left == NOT_PTR_ERROR)
@@ -2489,8 +4125,14 @@ not_attribute(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_n
         {
             if (not_helper_id_strcmp(binary->right, item->key) == 0)
             {
-                not_record_link_decrease(left);
-                return item->value;
+                not_record_t *result = item->value;
+                not_record_link_increase(result);
+                if (not_record_link_decrease(left) < 0)
+                {
+                    not_record_link_decrease(result);
+                    return NOT_PTR_ERROR;
+                }
+                return result;
             }
         }
 
@@ -2553,6 +4195,56 @@ not_attribute(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_n
             }
             return result;
         }
+        else if (not_helper_id_strcmp(binary->right, "Sort") == 0)
+        {
+            not_record_t *result = not_record_make_builtin(left, &not_attribute_tuple_builtin_sort);
+            if (result == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(left);
+                return NOT_PTR_ERROR;
+            }
+            return result;
+        }
+        else if (not_helper_id_strcmp(binary->right, "SortBy") == 0)
+        {
+            not_record_t *result = not_record_make_builtin(left, &not_attribute_tuple_builtin_sort_by);
+            if (result == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(left);
+                return NOT_PTR_ERROR;
+            }
+            return result;
+        }
+        else if (not_helper_id_strcmp(binary->right, "BinarySearch") == 0)
+        {
+            not_record_t *result = not_record_make_builtin(left, &not_attribute_tuple_builtin_binary_search);
+            if (result == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(left);
+                return NOT_PTR_ERROR;
+            }
+            return result;
+        }
+        else if (not_helper_id_strcmp(binary->right, "HeapPush") == 0)
+        {
+            not_record_t *result = not_record_make_builtin(left, &not_attribute_tuple_builtin_heap_push);
+            if (result == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(left);
+                return NOT_PTR_ERROR;
+            }
+            return result;
+        }
+        else if (not_helper_id_strcmp(binary->right, "HeapPop") == 0)
+        {
+            not_record_t *result = not_record_make_builtin(left, &not_attribute_tuple_builtin_heap_pop);
+            if (result == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(left);
+                return NOT_PTR_ERROR;
+            }
+            return result;
+        }
 
         not_node_basic_t *basic1 = (not_node_basic_t *)binary->right->value;
         not_error_type_by_node(node, "'%s' has no attribute '%s'",
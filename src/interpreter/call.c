@@ -37,6 +37,9 @@
 static not_record_t *
 not_call_provide_class(not_strip_t *strip, not_node_t *node, not_node_t *applicant);
 
+static not_record_t *
+not_call_trampoline(not_node_t *node, not_strip_t *strip, not_node_t *applicant);
+
 int32_t
 not_call_parameters_check_by_one_arg(not_node_t *base, not_strip_t *strip, not_node_t *parameters, not_record_t *arg, not_node_t *applicant)
 {
@@ -60,7 +63,7 @@ not_call_parameters_check_by_one_arg(not_node_t *base, not_strip_t *strip, not_n
 
                 if (parameter->type)
                 {
-                    not_record_t *record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                    not_record_t *record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                     if (record_parameter_type == NOT_PTR_ERROR)
                     {
                         if (not_record_link_decrease(record_arg) < 0)
@@ -89,7 +92,7 @@ not_call_parameters_check_by_one_arg(not_node_t *base, not_strip_t *strip, not_n
                         return -1;
                     }
 
-                    int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                    int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                     if (r1 < 0)
                     {
                         if (not_record_link_decrease(record_parameter_type) < 0)
@@ -241,7 +244,7 @@ not_call_parameters_check_by_one_arg(not_node_t *base, not_strip_t *strip, not_n
 
             if (parameter->type)
             {
-                not_record_t *record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                not_record_t *record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                 if (record_parameter_type == NOT_PTR_ERROR)
                 {
                     not_record_link_decrease(record_arg);
@@ -259,7 +262,7 @@ not_call_parameters_check_by_one_arg(not_node_t *base, not_strip_t *strip, not_n
                     return -1;
                 }
 
-                int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                 if (r1 < 0)
                 {
                     not_record_link_decrease(record_parameter_type);
@@ -394,7 +397,7 @@ not_call_parameters_subs_by_one_arg(not_node_t *base, not_node_t *scope, not_str
 
                 if (parameter->type)
                 {
-                    record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                    record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                     if (record_parameter_type == NOT_PTR_ERROR)
                     {
                         if (not_record_link_decrease(record_arg) < 0)
@@ -423,7 +426,7 @@ not_call_parameters_subs_by_one_arg(not_node_t *base, not_node_t *scope, not_str
                         return -1;
                     }
 
-                    int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                    int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                     if (r1 < 0)
                     {
                         if (not_record_link_decrease(record_parameter_type) < 0)
@@ -604,7 +607,7 @@ not_call_parameters_subs_by_one_arg(not_node_t *base, not_node_t *scope, not_str
             not_record_t *record_parameter_type = NULL;
             if (parameter->type)
             {
-                record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                 if (record_parameter_type == NOT_PTR_ERROR)
                 {
                     if (not_record_link_decrease(record_arg) < 0)
@@ -633,7 +636,7 @@ not_call_parameters_subs_by_one_arg(not_node_t *base, not_node_t *scope, not_str
                     return -1;
                 }
 
-                int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                 if (r1 < 0)
                 {
                     if (not_record_link_decrease(record_parameter_type) < 0)
@@ -769,7 +772,7 @@ not_call_parameters_subs_by_one_arg(not_node_t *base, not_node_t *scope, not_str
                     not_record_t *record_parameter_type = NULL;
                     if (parameter->type)
                     {
-                        record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                        record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                         if (record_parameter_type == NOT_PTR_ERROR)
                         {
                             if (not_record_link_decrease(record_arg) < 0)
@@ -798,7 +801,7 @@ not_call_parameters_subs_by_one_arg(not_node_t *base, not_node_t *scope, not_str
                             return -1;
                         }
 
-                        int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                        int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                         if (r1 < 0)
                         {
                             if (not_record_link_decrease(record_parameter_type) < 0)
@@ -954,9 +957,422 @@ not_call_parameters_subs_by_one_arg(not_node_t *base, not_node_t *scope, not_str
     return 0;
 }
 
+/*
+ * How the arguments of one call site land on the parameters of one callee,
+ * worked out on the first call. A direct plan names the parameter taken by
+ * each argument and the parameters left to their defaults; anything else
+ * (packing into karg/kwarg, errors) keeps going through the full matcher.
+ */
+typedef struct not_call_plan
+{
+    /* next plan kept by the same call site, the node frees the chain */
+    struct not_call_plan *next;
+    not_node_t *scope;
+    int32_t direct;
+    uint64_t count;
+    uint64_t rest;
+    not_node_t *slots[];
+} not_call_plan_t;
+
+static int32_t
+not_call_plan_contains(not_node_t **slots, uint64_t count, not_node_t *item)
+{
+    for (uint64_t i = 0; i < count; i++)
+    {
+        if (slots[i]->id == item->id)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static not_call_plan_t *
+not_call_plan_create(not_node_t *scope, not_node_t *parameters, not_node_t *arguments)
+{
+    uint64_t cnt1 = 0;
+    if (parameters)
+    {
+        not_node_block_t *block1 = (not_node_block_t *)parameters->value;
+        for (not_node_t *item1 = block1->items; item1 != NULL; item1 = item1->next)
+        {
+            cnt1 += 1;
+        }
+    }
+
+    not_call_plan_t *plan = (not_call_plan_t *)not_memory_calloc(1, sizeof(not_call_plan_t) + cnt1 * sizeof(not_node_t *));
+    if (!plan)
+    {
+        not_error_no_memory();
+        return NOT_PTR_ERROR;
+    }
+
+    plan->scope = scope;
+    plan->direct = 0;
+
+    not_node_t *item1 = NULL;
+    if (parameters)
+    {
+        not_node_block_t *block1 = (not_node_block_t *)parameters->value;
+        item1 = block1->items;
+    }
+
+    if (arguments)
+    {
+        not_node_block_t *block2 = (not_node_block_t *)arguments->value;
+        for (not_node_t *item2 = block2->items; item2 != NULL; item2 = item2->next)
+        {
+            not_node_argument_t *argument = (not_node_argument_t *)item2->value;
+            if (!item1)
+            {
+                return plan;
+            }
+
+            not_node_t *target = NULL;
+            if (argument->value)
+            {
+                not_node_parameter_t *parameter1 = (not_node_parameter_t *)item1->value;
+                if ((parameter1->flag & SYNTAX_MODIFIER_KWARG) == SYNTAX_MODIFIER_KWARG)
+                {
+                    return plan;
+                }
+
+                for (not_node_t *item3 = item1; item3 != NULL; item3 = item3->next)
+                {
+                    not_node_parameter_t *parameter = (not_node_parameter_t *)item3->value;
+                    if (not_helper_id_cmp(argument->key, parameter->key) == 0)
+                    {
+                        target = item3;
+                        break;
+                    }
+                }
+
+                if (target == NULL)
+                {
+                    return plan;
+                }
+            }
+            else
+            {
+                target = item1;
+                item1 = item1->next;
+            }
+
+            not_node_parameter_t *parameter = (not_node_parameter_t *)target->value;
+            if ((parameter->flag & (SYNTAX_MODIFIER_KARG | SYNTAX_MODIFIER_KWARG)) != 0)
+            {
+                return plan;
+            }
+
+            if (not_call_plan_contains(plan->slots, plan->count, target) == 1)
+            {
+                return plan;
+            }
+
+            plan->slots[plan->count++] = target;
+        }
+    }
+
+    if (parameters)
+    {
+        not_node_block_t *block1 = (not_node_block_t *)parameters->value;
+        for (not_node_t *item3 = block1->items; item3 != NULL; item3 = item3->next)
+        {
+            if (not_call_plan_contains(plan->slots, plan->count, item3) == 1)
+            {
+                continue;
+            }
+
+            not_node_parameter_t *parameter = (not_node_parameter_t *)item3->value;
+            if ((parameter->value == NULL) && ((parameter->flag & (SYNTAX_MODIFIER_KARG | SYNTAX_MODIFIER_KWARG)) == 0))
+            {
+                return plan;
+            }
+
+            plan->slots[plan->count + plan->rest] = item3;
+            plan->rest += 1;
+        }
+    }
+
+    plan->direct = 1;
+    return plan;
+}
+
+/*
+ * A call site keeps the plans of the first few callees it meets. One that
+ * meets more than that is left to the full matcher rather than rebuilding
+ * a plan on every call.
+ */
+#define NOT_CALL_PLANS 4
+
+static not_call_plan_t *
+not_call_plan(not_node_t *base, not_node_t *scope, not_node_t *parameters, not_node_t *arguments)
+{
+    not_node_carrier_t *carrier = (not_node_carrier_t *)base->value;
+    if (carrier->data != arguments)
+    {
+        return NULL;
+    }
+
+    uint64_t cnt = 0;
+    for (not_call_plan_t *plan = (not_call_plan_t *)carrier->cache; plan != NULL; plan = plan->next)
+    {
+        if (plan->scope->id == scope->id)
+        {
+            return plan;
+        }
+        cnt += 1;
+    }
+
+    if (cnt >= NOT_CALL_PLANS)
+    {
+        return NULL;
+    }
+
+    not_call_plan_t *plan = not_call_plan_create(scope, parameters, arguments);
+    if (plan == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    plan->next = (not_call_plan_t *)carrier->cache;
+    carrier->cache = plan;
+
+    return plan;
+}
+
+/*
+ * Evaluates one argument or default and stores it as the parameter's input,
+ * with the same checks, casts and copies as the full matcher.
+ */
+static int32_t
+not_call_plan_bind(not_node_t *base, not_node_t *scope, not_strip_t *strip, not_node_t *item, not_node_t *expression, not_node_t *argument, not_node_t *applicant)
+{
+    not_node_parameter_t *parameter = (not_node_parameter_t *)item->value;
+
+    not_record_t *record_arg = not_expression(expression, strip, applicant, NULL);
+    if (record_arg == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    if (parameter->type)
+    {
+        not_record_t *record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
+        if (record_parameter_type == NOT_PTR_ERROR)
+        {
+            not_record_link_decrease(record_arg);
+            return -1;
+        }
+
+        if (record_parameter_type->kind != RECORD_KIND_TYPE)
+        {
+            not_node_basic_t *basic1 = (not_node_basic_t *)parameter->key->value;
+            not_error_type_by_node(parameter->type, "'%s' unsupported type: '%s'",
+                                   basic1->value, not_record_type_as_string(record_parameter_type));
+
+            not_record_link_decrease(record_parameter_type);
+            not_record_link_decrease(record_arg);
+
+            return -1;
+        }
+
+        int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
+        if (r1 < 0)
+        {
+            not_record_link_decrease(record_parameter_type);
+            not_record_link_decrease(record_arg);
+
+            return -1;
+        }
+        else if (r1 == 0)
+        {
+            if ((parameter->flag & SYNTAX_MODIFIER_REFERENCE) == SYNTAX_MODIFIER_REFERENCE)
+            {
+                if (argument)
+                {
+                    not_error_type_by_node(argument, "'%s' mismatch: '%s' and '%s'",
+                                           "argument", not_record_type_as_string(record_arg), not_record_type_as_string(record_parameter_type));
+                }
+                else
+                {
+                    not_node_basic_t *basic1 = (not_node_basic_t *)parameter->key->value;
+                    not_error_type_by_node(parameter->key, "'%s' mismatch: '%s' and '%s'",
+                                           basic1->value, not_record_type_as_string(record_arg), not_record_type_as_string(record_parameter_type));
+                }
+
+                not_record_link_decrease(record_parameter_type);
+                not_record_link_decrease(record_arg);
+
+                return -1;
+            }
+            else
+            {
+                not_record_t *record_copy = not_record_copy(record_arg);
+                if (record_copy == NOT_PTR_ERROR)
+                {
+                    not_record_link_decrease(record_parameter_type);
+                    not_record_link_decrease(record_arg);
+                    return -1;
+                }
+
+                if (not_record_link_decrease(record_arg) < 0)
+                {
+                    not_record_link_decrease(record_parameter_type);
+                    return -1;
+                }
+
+                not_record_t *record_casted = not_execute_value_casting_by_type(parameter->key, record_copy, record_parameter_type);
+                if (record_casted == NOT_PTR_ERROR)
+                {
+                    not_record_link_decrease(record_parameter_type);
+                    not_record_link_decrease(record_copy);
+
+                    return -1;
+                }
+                else if (record_casted == NULL)
+                {
+                    not_node_basic_t *basic1 = (not_node_basic_t *)parameter->key->value;
+                    not_error_type_by_node(parameter->key, "'%s' mismatch: '%s' and '%s'",
+                                           basic1->value, not_record_type_as_string(record_copy), not_record_type_as_string(record_parameter_type));
+
+                    not_record_link_decrease(record_parameter_type);
+                    not_record_link_decrease(record_copy);
+
+                    return -1;
+                }
+
+                record_arg = record_copy;
+            }
+        }
+
+        if (not_record_link_decrease(record_parameter_type) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if ((parameter->flag & SYNTAX_MODIFIER_REFERENCE) != SYNTAX_MODIFIER_REFERENCE)
+    {
+        not_record_t *record_copy = not_record_copy(record_arg);
+        if (record_copy == NOT_PTR_ERROR)
+        {
+            not_record_link_decrease(record_arg);
+            return -1;
+        }
+
+        if (not_record_link_decrease(record_arg) < 0)
+        {
+            return -1;
+        }
+
+        record_arg = record_copy;
+
+        if ((parameter->flag & SYNTAX_MODIFIER_READONLY) == SYNTAX_MODIFIER_READONLY)
+        {
+            record_arg->readonly = 1;
+        }
+
+        if (parameter->type)
+        {
+            record_arg->typed = 1;
+        }
+    }
+
+    if (NOT_PTR_ERROR == not_strip_input_push(strip, scope, item, parameter->key, record_arg))
+    {
+        not_record_link_decrease(record_arg);
+        return -1;
+    }
+
+    return 0;
+}
+
+static int32_t
+not_call_plan_execute(not_call_plan_t *plan, not_node_t *base, not_node_t *scope, not_strip_t *strip, not_node_t *arguments, not_node_t *applicant)
+{
+    if (arguments)
+    {
+        not_node_block_t *block2 = (not_node_block_t *)arguments->value;
+        uint64_t i = 0;
+        for (not_node_t *item2 = block2->items; item2 != NULL; item2 = item2->next, i++)
+        {
+            not_node_argument_t *argument = (not_node_argument_t *)item2->value;
+            not_node_t *expression = argument->value ? argument->value : argument->key;
+
+            if (not_call_plan_bind(base, scope, strip, plan->slots[i], expression, argument->key, applicant) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    for (uint64_t i = plan->count; i < plan->count + plan->rest; i++)
+    {
+        not_node_t *item1 = plan->slots[i];
+        not_node_parameter_t *parameter = (not_node_parameter_t *)item1->value;
+
+        if (parameter->value)
+        {
+            if (not_call_plan_bind(base, scope, strip, item1, parameter->value, NULL, applicant) < 0)
+            {
+                return -1;
+            }
+            continue;
+        }
+
+        not_record_t *record_arg = NULL;
+        if ((parameter->flag & SYNTAX_MODIFIER_KARG) == SYNTAX_MODIFIER_KARG)
+        {
+            record_arg = not_record_create(RECORD_KIND_TUPLE, NULL);
+        }
+        else
+        {
+            record_arg = not_record_create(RECORD_KIND_OBJECT, NULL);
+        }
+
+        if (record_arg == NOT_PTR_ERROR)
+        {
+            return -1;
+        }
+
+        if ((parameter->flag & SYNTAX_MODIFIER_READONLY) == SYNTAX_MODIFIER_READONLY)
+        {
+            record_arg->readonly = 1;
+        }
+
+        if (parameter->type)
+        {
+            record_arg->typed = 1;
+        }
+
+        if (NOT_PTR_ERROR == not_strip_input_push(strip, scope, item1, parameter->key, record_arg))
+        {
+            not_record_link_decrease(record_arg);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 int32_t
 not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip, not_node_t *parameters, not_node_t *arguments, not_node_t *applicant)
 {
+    if ((base->kind == NODE_KIND_CALL) || (base->kind == NODE_KIND_ARRAY))
+    {
+        not_call_plan_t *plan = not_call_plan(base, scope, parameters, arguments);
+        if (plan == NOT_PTR_ERROR)
+        {
+            return -1;
+        }
+        else if (plan && (plan->direct == 1))
+        {
+            return not_call_plan_execute(plan, base, scope, strip, arguments, applicant);
+        }
+    }
+
     if (arguments)
     {
         not_node_block_t *block1 = (not_node_block_t *)arguments->value;
@@ -1073,7 +1489,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
                             not_record_t *record_parameter_type = NULL;
                             if (parameter->type)
                             {
-                                record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                                record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                                 if (record_parameter_type == NOT_PTR_ERROR)
                                 {
                                     not_record_link_decrease(record_arg);
@@ -1102,7 +1518,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
                                     return -1;
                                 }
 
-                                int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                                int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                                 if (r1 < 0)
                                 {
                                     not_record_link_decrease(record_parameter_type);
@@ -1289,7 +1705,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
 
                                 if (parameter->type)
                                 {
-                                    not_record_t *record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                                    not_record_t *record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                                     if (record_parameter_type == NOT_PTR_ERROR)
                                     {
                                         not_record_link_decrease(record_arg);
@@ -1308,7 +1724,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
                                         return -1;
                                     }
 
-                                    int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                                    int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                                     if (r1 < 0)
                                     {
                                         not_record_link_decrease(record_parameter_type);
@@ -1459,7 +1875,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
 
                             if (parameter->type)
                             {
-                                not_record_t *record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                                not_record_t *record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                                 if (record_parameter_type == NOT_PTR_ERROR)
                                 {
                                     not_record_link_decrease(record_arg);
@@ -1486,7 +1902,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
                                     return -1;
                                 }
 
-                                int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                                int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                                 if (r1 < 0)
                                 {
                                     not_record_link_decrease(record_parameter_type);
@@ -1657,7 +2073,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
 
                         if (parameter->type)
                         {
-                            not_record_t *record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                            not_record_t *record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                             if (record_parameter_type == NOT_PTR_ERROR)
                             {
                                 not_record_link_decrease(record_arg);
@@ -1676,7 +2092,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
                                 return -1;
                             }
 
-                            int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                            int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                             if (r1 < 0)
                             {
                                 not_record_link_decrease(record_parameter_type);
@@ -1800,7 +2216,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
 
                     if (parameter->type)
                     {
-                        not_record_t *record_parameter_type = not_expression(parameter->type, strip, applicant, NULL);
+                        not_record_t *record_parameter_type = not_execute_type_by_site(parameter->type, &parameter->check, strip, applicant);
                         if (record_parameter_type == NOT_PTR_ERROR)
                         {
                             not_record_link_decrease(record_arg);
@@ -1819,7 +2235,7 @@ not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip
                             return -1;
                         }
 
-                        int32_t r1 = not_execute_value_check_by_type(base, record_arg, record_parameter_type);
+                        int32_t r1 = not_execute_value_check_by_site(base, &parameter->check, record_arg, record_parameter_type);
                         if (r1 < 0)
                         {
                             not_record_link_decrease(record_parameter_type);
@@ -2227,7 +2643,7 @@ not_call_property_subs(not_node_t *scope, not_strip_t *strip, not_node_t *node,
 
     if (property->type)
     {
-        not_record_t *record_parameter_type = not_expression(property->type, strip, applicant, NULL);
+        not_record_t *record_parameter_type = not_execute_type_by_site(property->type, &property->check, strip, applicant);
         if (record_parameter_type == NOT_PTR_ERROR)
         {
             not_record_link_decrease(record_value);
@@ -2246,7 +2662,7 @@ not_call_property_subs(not_node_t *scope, not_strip_t *strip, not_node_t *node,
             return -1;
         }
 
-        int32_t r1 = not_execute_value_check_by_type(property->key, record_value, record_parameter_type);
+        int32_t r1 = not_execute_value_check_by_site(property->key, &property->check, record_value, record_parameter_type);
         if (r1 < 0)
         {
             not_record_link_decrease(record_parameter_type);
@@ -2329,14 +2745,197 @@ not_call_property_subs(not_node_t *scope, not_strip_t *strip, not_node_t *node,
     return 0;
 }
 
+static int32_t
+not_call_property_subs_by_value(not_node_t *scope, not_strip_t *strip, not_node_t *node, not_record_t *value)
+{
+    not_node_property_t *property = (not_node_property_t *)node->value;
+
+    not_record_t *record_value = not_record_copy(value);
+    if (record_value == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    if ((property->flag & SYNTAX_MODIFIER_READONLY) == SYNTAX_MODIFIER_READONLY)
+    {
+        record_value->readonly = 1;
+    }
+
+    not_entry_t *entry = not_strip_variable_push(strip, scope, node, property->key, record_value);
+    if (entry == NOT_PTR_ERROR)
+    {
+        if (not_record_link_decrease(record_value) < 0)
+        {
+            return -1;
+        }
+        return -1;
+    }
+
+    return 0;
+}
+
+uint64_t
+not_call_class_layout(not_node_t *node)
+{
+    not_node_class_t *class1 = (not_node_class_t *)node->value;
+
+    uint64_t count = 0;
+    if (class1->heritages)
+    {
+        not_node_block_t *block = (not_node_block_t *)class1->heritages->value;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
+        {
+            count += 1;
+        }
+    }
+
+    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    {
+        if (item->kind == NODE_KIND_PROPERTY)
+        {
+            not_node_property_t *property = (not_node_property_t *)item->value;
+            if ((property->flag & SYNTAX_MODIFIER_STATIC) != SYNTAX_MODIFIER_STATIC)
+            {
+                count += 1;
+            }
+        }
+    }
+
+    return count;
+}
+
+/*
+ * What every instance of a class starts from, built on its first instance:
+ * the constructor, the slot layout and, per non-static property, the value of
+ * an untyped literal initializer. Those values live as long as the program and
+ * are copied into each instance, other initializers are evaluated every time.
+ */
+typedef struct not_call_prototype
+{
+    not_node_t *constructor;
+    uint64_t layout;
+    uint64_t count;
+    not_record_t *values[];
+} not_call_prototype_t;
+
+static int32_t
+not_call_prototype_is_literal(not_node_t *node)
+{
+    return (node->kind == NODE_KIND_NUMBER) || (node->kind == NODE_KIND_CHAR) ||
+           (node->kind == NODE_KIND_STRING) || (node->kind == NODE_KIND_NULL) ||
+           (node->kind == NODE_KIND_UNDEFINED) || (node->kind == NODE_KIND_NAN);
+}
+
+static not_call_prototype_t *
+not_call_prototype(not_strip_t *strip, not_node_t *node, not_node_t *applicant)
+{
+    not_node_class_t *class1 = (not_node_class_t *)node->value;
+    if (class1->prototype)
+    {
+        return (not_call_prototype_t *)class1->prototype;
+    }
+
+    uint64_t count = 0;
+    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    {
+        if (item->kind == NODE_KIND_PROPERTY)
+        {
+            not_node_property_t *property = (not_node_property_t *)item->value;
+            if ((property->flag & SYNTAX_MODIFIER_STATIC) != SYNTAX_MODIFIER_STATIC)
+            {
+                count += 1;
+            }
+        }
+    }
+
+    not_call_prototype_t *prototype = (not_call_prototype_t *)not_memory_calloc(1, sizeof(not_call_prototype_t) + count * sizeof(not_record_t *));
+    if (prototype == NULL)
+    {
+        not_error_no_memory();
+        return NOT_PTR_ERROR;
+    }
+
+    prototype->layout = not_call_class_layout(node);
+    prototype->count = count;
+
+    uint64_t index = 0;
+    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    {
+        if (item->kind == NODE_KIND_PROPERTY)
+        {
+            not_node_property_t *property = (not_node_property_t *)item->value;
+            if ((property->flag & SYNTAX_MODIFIER_STATIC) == SYNTAX_MODIFIER_STATIC)
+            {
+                continue;
+            }
+
+            if (property->type == NULL)
+            {
+                not_record_t *value = NULL;
+                if (property->value == NULL)
+                {
+                    value = not_record_make_undefined();
+                }
+                else if (not_call_prototype_is_literal(property->value))
+                {
+                    value = not_expression(property->value, strip, applicant, NULL);
+                }
+
+                if (value == NOT_PTR_ERROR)
+                {
+                    for (uint64_t i = 0; i < index; i++)
+                    {
+                        if (prototype->values[i])
+                        {
+                            not_record_link_decrease(prototype->values[i]);
+                        }
+                    }
+                    not_memory_free(prototype);
+                    return NOT_PTR_ERROR;
+                }
+
+                prototype->values[index] = value;
+            }
+
+            index += 1;
+        }
+        else if ((item->kind == NODE_KIND_FUN) && (prototype->constructor == NULL))
+        {
+            not_node_fun_t *fun1 = (not_node_fun_t *)item->value;
+            if (not_helper_id_strcmp(fun1->key, CONSTRUCTOR_STR) == 0)
+            {
+                prototype->constructor = item;
+            }
+        }
+    }
+
+    class1->prototype = prototype;
+
+    return prototype;
+}
+
 static not_record_t *
 not_call_provide_class(not_strip_t *strip, not_node_t *node, not_node_t *applicant)
 {
     not_node_class_t *class1 = (not_node_class_t *)node->value;
 
-    not_strip_t *strip_copy = not_strip_copy(strip);
+    not_call_prototype_t *prototype = not_call_prototype(strip, node, applicant);
+    if (prototype == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    not_strip_t *strip_previous = not_strip_copy(strip);
+    if (strip_previous == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    /* the instance is a level of its own, one slot per heritage then per field */
+    not_strip_t *strip_copy = not_strip_create_by_capacity(strip_previous, prototype->layout);
     if (strip_copy == NOT_PTR_ERROR)
     {
+        not_strip_destroy(strip_previous);
         return NOT_PTR_ERROR;
     }
 
@@ -2353,6 +2952,7 @@ not_call_provide_class(not_strip_t *strip, not_node_t *node, not_node_t *applica
         }
     }
 
+    uint64_t index = 0;
     for (not_node_t *item = class1->block; item != NULL; item = item->next)
     {
         if (item->kind == NODE_KIND_PROPERTY)
@@ -2360,10 +2960,22 @@ not_call_provide_class(not_strip_t *strip, not_node_t *node, not_node_t *applica
             not_node_property_t *property = (not_node_property_t *)item->value;
             if ((property->flag & SYNTAX_MODIFIER_STATIC) != SYNTAX_MODIFIER_STATIC)
             {
-                if (not_call_property_subs(node, strip_copy, item, applicant) < 0)
+                not_record_t *value = prototype->values[index++];
+                if (value)
                 {
-                    not_strip_destroy(strip_copy);
-                    return NOT_PTR_ERROR;
+                    if (not_call_property_subs_by_value(node, strip_copy, item, value) < 0)
+                    {
+                        not_strip_destroy(strip_copy);
+                        return NOT_PTR_ERROR;
+                    }
+                }
+                else
+                {
+                    if (not_call_property_subs(node, strip_copy, item, applicant) < 0)
+                    {
+                        not_strip_destroy(strip_copy);
+                        return NOT_PTR_ERROR;
+                    }
                 }
             }
         }
@@ -2415,35 +3027,178 @@ not_call_operator_by_one_arg(not_node_t *base, not_record_t *content, not_record
                     return NOT_PTR_ERROR;
                 }
 
-                int32_t r1 = not_execute_fun(item, strip_copy, applicant);
+                not_record_t *rax = NULL;
+                int32_t r1 = not_execute_fun(item, strip_copy, applicant, &rax);
                 if (r1 == -1)
                 {
+                    if (rax)
+                    {
+                        not_record_link_decrease(rax);
+                    }
                     not_strip_destroy(strip_copy);
                     return NOT_PTR_ERROR;
                 }
 
                 if (not_strip_destroy(strip_copy) < 0)
                 {
+                    if (rax)
+                    {
+                        not_record_link_decrease(rax);
+                    }
                     return NOT_PTR_ERROR;
                 }
 
-                not_record_t *rax = not_thread_get_and_set_rax(NULL);
-                if (rax == NOT_PTR_ERROR)
-                {
-                    return NOT_PTR_ERROR;
-                }
-                else if (!rax)
+                if (!rax)
                 {
                     rax = not_record_make_undefined();
                 }
 
-                return rax;
+                return rax;
+            }
+        }
+    }
+
+    not_node_basic_t *basic1 = (not_node_basic_t *)class1->key->value;
+    not_error_type_by_node(base, "'%s' no operator %s was found", basic1->value, operator);
+
+    return NOT_PTR_ERROR;
+}
+
+/*
+ * Runs a fun or lambda whose arguments are already bound in strip, which it
+ * takes over, in the frame and shadow stack entry every call gets. NULL when
+ * the callee left a tail call pending for the trampoline of the caller.
+ */
+static not_record_t *
+not_call_enter(not_node_t *base, not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+{
+    uint64_t flag = (node->kind == NODE_KIND_FUN) ? ((not_node_fun_t *)node->value)->flag : ((not_node_lambda_t *)node->value)->flag;
+    if ((flag & SYNTAX_MODIFIER_GENERATOR) == SYNTAX_MODIFIER_GENERATOR)
+    {
+        not_record_t *result = not_generator_create(node, strip, applicant);
+        if (result == NOT_PTR_ERROR)
+        {
+            not_strip_destroy(strip);
+            return NOT_PTR_ERROR;
+        }
+
+        return result;
+    }
+
+    not_interpreter_t *interpreter = not_thread_get_interpreter();
+    void *frame = interpreter->frame;
+    interpreter->frame = strip;
+
+    not_interpreter_call_t call;
+    call.callee = node;
+    call.site = base;
+    call.previous = interpreter->calls;
+    interpreter->calls = &call;
+
+    not_record_t *rax = NULL;
+    int32_t r1 = 0;
+    if (node->kind == NODE_KIND_FUN)
+    {
+        r1 = not_execute_fun(node, strip, applicant, &rax);
+    }
+    else
+    {
+        r1 = not_execute_lambda(node, strip, applicant, &rax);
+    }
+
+    interpreter->calls = call.previous;
+    interpreter->frame = frame;
+
+    if (r1 == -6)
+    {
+        if (not_strip_destroy(strip) < 0)
+        {
+            return NOT_PTR_ERROR;
+        }
+        return NULL;
+    }
+    else if (r1 < 0)
+    {
+        if (rax)
+        {
+            not_record_link_decrease(rax);
+        }
+        not_strip_destroy(strip);
+        return NOT_PTR_ERROR;
+    }
+
+    if (not_strip_destroy(strip) < 0)
+    {
+        if (rax)
+        {
+            not_record_link_decrease(rax);
+        }
+        return NOT_PTR_ERROR;
+    }
+
+    if (!rax)
+    {
+        rax = not_record_make_undefined();
+    }
+
+    return rax;
+}
+
+not_record_t *
+not_call_by_one_arg(not_node_t *base, not_record_t *content, not_record_t *arg, not_strip_t *strip, not_node_t *applicant)
+{
+    if (content->kind == RECORD_KIND_TYPE)
+    {
+        not_record_type_t *record_type = (not_record_type_t *)content->value;
+        not_node_t *type = record_type->type;
+
+        if ((type->kind == NODE_KIND_FUN) || (type->kind == NODE_KIND_LAMBDA))
+        {
+            not_node_t *parameters = NULL;
+            if (type->kind == NODE_KIND_FUN)
+            {
+                not_node_fun_t *fun1 = (not_node_fun_t *)type->value;
+                parameters = fun1->parameters;
+            }
+            else
+            {
+                not_node_lambda_t *fun1 = (not_node_lambda_t *)type->value;
+                parameters = fun1->parameters;
+            }
+
+            not_strip_t *strip_copy = not_strip_copy((not_strip_t *)record_type->value);
+            if (strip_copy == NOT_PTR_ERROR)
+            {
+                return NOT_PTR_ERROR;
+            }
+
+            not_strip_t *strip_local = not_strip_copy(strip);
+            if (strip_local == NOT_PTR_ERROR)
+            {
+                not_strip_destroy(strip_copy);
+                return NOT_PTR_ERROR;
+            }
+
+            not_strip_attach(strip_copy, strip_local);
+
+            if (not_call_parameters_subs_by_one_arg(base, type, strip_copy, parameters, arg, applicant) < 0)
+            {
+                not_strip_destroy(strip_copy);
+                return NOT_PTR_ERROR;
             }
+
+            not_record_t *result = not_call_enter(base, type, strip_copy, applicant);
+            if (result == NULL)
+            {
+                return not_call_trampoline(base, strip, applicant);
+            }
+
+            return result;
         }
     }
 
-    not_node_basic_t *basic1 = (not_node_basic_t *)class1->key->value;
-    not_error_type_by_node(base, "'%s' no operator %s was found", basic1->value, operator);
+    not_error_type_by_node(base, "'%s' object is not callable",
+                           not_record_type_as_string(content));
 
     return NOT_PTR_ERROR;
 }
@@ -2485,71 +3240,81 @@ not_call_class(not_node_t *base, not_node_t *arguments, not_strip_t *strip, not_
         }
     }
 
-    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    not_call_prototype_t *prototype = (not_call_prototype_t *)class1->prototype;
+    not_node_t *item = prototype->constructor;
+    if (item)
     {
-        if (item->kind == NODE_KIND_FUN)
+        not_node_fun_t *fun1 = (not_node_fun_t *)item->value;
+        if ((fun1->flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT)
         {
-            not_node_fun_t *fun1 = (not_node_fun_t *)item->value;
-            if (not_helper_id_strcmp(fun1->key, CONSTRUCTOR_STR) == 0)
-            {
-                if ((fun1->flag & SYNTAX_MODIFIER_EXPORT) != SYNTAX_MODIFIER_EXPORT)
-                {
-                    not_node_basic_t *basic1 = (not_node_basic_t *)fun1->key->value;
-                    not_node_basic_t *basic2 = (not_node_basic_t *)class1->key->value;
-                    not_error_type_by_node(base, "'%s' unexpected access to '%s'",
-                                           basic2->value, basic1->value);
-                    not_record_link_decrease(content);
-                    return NOT_PTR_ERROR;
-                }
+            not_node_basic_t *basic1 = (not_node_basic_t *)fun1->key->value;
+            not_node_basic_t *basic2 = (not_node_basic_t *)class1->key->value;
+            not_error_type_by_node(base, "'%s' unexpected access to '%s'",
+                                   basic2->value, basic1->value);
+            not_record_link_decrease(content);
+            return NOT_PTR_ERROR;
+        }
 
-                not_strip_t *strip_copy = not_strip_copy(strip_class);
-                if (strip_copy == NOT_PTR_ERROR)
-                {
-                    not_record_link_decrease(content);
-                    return NOT_PTR_ERROR;
-                }
+        not_strip_t *strip_copy = not_strip_copy(strip_class);
+        if (strip_copy == NOT_PTR_ERROR)
+        {
+            not_record_link_decrease(content);
+            return NOT_PTR_ERROR;
+        }
 
-                if (not_call_parameters_subs(base, item, strip_copy, fun1->parameters, arguments, applicant) < 0)
-                {
-                    not_strip_destroy(strip_copy);
-                    not_record_link_decrease(content);
-                    return NOT_PTR_ERROR;
-                }
+        if (not_call_parameters_subs(base, item, strip_copy, fun1->parameters, arguments, applicant) < 0)
+        {
+            not_strip_destroy(strip_copy);
+            not_record_link_decrease(content);
+            return NOT_PTR_ERROR;
+        }
 
-                int32_t r1 = not_execute_fun(item, strip_copy, applicant);
-                if (r1 < 0)
-                {
-                    not_strip_destroy(strip_copy);
-                    not_record_link_decrease(content);
-                    return NOT_PTR_ERROR;
-                }
+        not_interpreter_t *interpreter = not_thread_get_interpreter();
+        not_interpreter_call_t call;
+        call.callee = type;
+        call.site = base;
+        call.previous = interpreter->calls;
+        interpreter->calls = &call;
 
-                if (not_strip_destroy(strip_copy) < 0)
-                {
-                    not_record_link_decrease(content);
-                    return NOT_PTR_ERROR;
-                }
+        not_record_t *rax = NULL;
+        int32_t r1 = not_execute_fun(item, strip_copy, applicant, &rax);
 
-                not_record_t *rax = not_thread_get_and_set_rax(NULL);
-                if (rax == NOT_PTR_ERROR)
-                {
-                    return NOT_PTR_ERROR;
-                }
-                else if (!rax)
-                {
-                    rax = content;
-                }
-                else
-                {
-                    if (not_record_link_decrease(content) < 0)
-                    {
-                        return NOT_PTR_ERROR;
-                    }
-                }
+        interpreter->calls = call.previous;
 
-                return rax;
+        if (r1 < 0)
+        {
+            if (rax)
+            {
+                not_record_link_decrease(rax);
+            }
+            not_strip_destroy(strip_copy);
+            not_record_link_decrease(content);
+            return NOT_PTR_ERROR;
+        }
+
+        if (not_strip_destroy(strip_copy) < 0)
+        {
+            if (rax)
+            {
+                not_record_link_decrease(rax);
+            }
+            not_record_link_decrease(content);
+            return NOT_PTR_ERROR;
+        }
+
+        if (!rax)
+        {
+            rax = content;
+        }
+        else
+        {
+            if (not_record_link_decrease(content) < 0)
+            {
+                return NOT_PTR_ERROR;
             }
         }
+
+        return rax;
     }
 
     not_node_basic_t *basic1 = (not_node_basic_t *)class1->key->value;
@@ -2588,29 +3353,7 @@ not_call_fun(not_node_t *base, not_node_t *arguments, not_strip_t *strip, not_no
         return NOT_PTR_ERROR;
     }
 
-    int32_t r1 = not_execute_fun(node, strip_copy, applicant);
-    if (r1 < 0)
-    {
-        not_strip_destroy(strip_copy);
-        return NOT_PTR_ERROR;
-    }
-
-    if (not_strip_destroy(strip_copy) < 0)
-    {
-        return NOT_PTR_ERROR;
-    }
-
-    not_record_t *rax = not_thread_get_and_set_rax(NULL);
-    if (rax == NOT_PTR_ERROR)
-    {
-        return NOT_PTR_ERROR;
-    }
-    else if (!rax)
-    {
-        rax = not_record_make_undefined();
-    }
-
-    return rax;
+    return not_call_enter(base, node, strip_copy, applicant);
 }
 
 static not_record_t *
@@ -2643,29 +3386,7 @@ not_call_lambda(not_node_t *base, not_node_t *arguments, not_strip_t *strip, not
         return NOT_PTR_ERROR;
     }
 
-    int32_t r1 = not_execute_lambda(node, strip_copy, applicant);
-    if (r1 < 0)
-    {
-        not_strip_destroy(strip_copy);
-        return NOT_PTR_ERROR;
-    }
-
-    if (not_strip_destroy(strip_copy) < 0)
-    {
-        return NOT_PTR_ERROR;
-    }
-
-    not_record_t *rax = not_thread_get_and_set_rax(NULL);
-    if (rax == NOT_PTR_ERROR)
-    {
-        return NOT_PTR_ERROR;
-    }
-    else if (!rax)
-    {
-        rax = not_record_make_undefined();
-    }
-
-    return rax;
+    return not_call_enter(base, node, strip_copy, applicant);
 }
 
 void mpf_round(mpf_t rop, const mpf_t op, int64_t n)
@@ -3322,16 +4043,107 @@ region_cleanup:
     return NOT_PTR_ERROR;
 }
 
-not_record_t *
-not_call(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
+/*
+ * Runs the tail calls left pending by return statements, each in a fresh
+ * frame whose caller is the one that made the original call, so a chain of
+ * tail calls keeps the C stack and the strips at a constant depth.
+ */
+static not_record_t *
+not_call_trampoline(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
 {
-    not_node_carrier_t *carrier = (not_node_carrier_t *)node->value;
+    not_interpreter_t *interpreter = not_thread_get_interpreter();
 
-    not_record_t *record_base = not_expression(carrier->base, strip, applicant, origin);
-    if (record_base == NOT_PTR_ERROR)
+    while (1)
     {
-        return NOT_PTR_ERROR;
+        not_record_t *record_base = interpreter->tail;
+        not_strip_t *strip_copy = (not_strip_t *)interpreter->tail_strip;
+
+        interpreter->tail = NULL;
+        interpreter->tail_strip = NULL;
+
+        not_record_type_t *record_type = (not_record_type_t *)record_base->value;
+        not_node_t *type = record_type->type;
+
+        not_strip_t *strip_local = not_strip_copy(strip);
+        if (strip_local == NOT_PTR_ERROR)
+        {
+            not_strip_destroy(strip_copy);
+            not_record_link_decrease(record_base);
+            return NOT_PTR_ERROR;
+        }
+
+        not_strip_attach(strip_copy, strip_local);
+
+        void *frame = interpreter->frame;
+        interpreter->frame = strip_copy;
+
+        not_interpreter_call_t call;
+        call.callee = type;
+        call.site = node;
+        call.previous = interpreter->calls;
+        interpreter->calls = &call;
+
+        not_record_t *rax = NULL;
+        int32_t r1 = 0;
+        if (type->kind == NODE_KIND_FUN)
+        {
+            r1 = not_execute_fun(type, strip_copy, applicant, &rax);
+        }
+        else
+        {
+            r1 = not_execute_lambda(type, strip_copy, applicant, &rax);
+        }
+
+        interpreter->calls = call.previous;
+        interpreter->frame = frame;
+
+        if ((r1 < 0) && rax)
+        {
+            not_record_link_decrease(rax);
+            rax = NULL;
+        }
+
+        if (not_strip_destroy(strip_copy) < 0)
+        {
+            if (rax)
+            {
+                not_record_link_decrease(rax);
+            }
+            not_record_link_decrease(record_base);
+            return NOT_PTR_ERROR;
+        }
+
+        if (not_record_link_decrease(record_base) < 0)
+        {
+            if (rax)
+            {
+                not_record_link_decrease(rax);
+            }
+            return NOT_PTR_ERROR;
+        }
+
+        if (r1 == -6)
+        {
+            continue;
+        }
+        else if (r1 < 0)
+        {
+            return NOT_PTR_ERROR;
+        }
+
+        if (!rax)
+        {
+            rax = not_record_make_undefined();
+        }
+
+        return rax;
     }
+}
+
+static not_record_t *
+not_call_by_record(not_node_t *node, not_record_t *record_base, not_strip_t *strip, not_node_t *applicant)
+{
+    not_node_carrier_t *carrier = (not_node_carrier_t *)node->value;
 
     if (record_base->kind == RECORD_KIND_TYPE)
     {
@@ -3402,7 +4214,7 @@ not_call(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t
 
             if (not_strip_destroy(strip_copy) < 0)
             {
-                if (result != NOT_PTR_ERROR)
+                if ((result != NOT_PTR_ERROR) && (result != NULL))
                 {
                     not_record_link_decrease(result);
                 }
@@ -3419,6 +4231,10 @@ not_call(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t
             {
                 return NOT_PTR_ERROR;
             }
+            else if (result == NULL)
+            {
+                return not_call_trampoline(node, strip, applicant);
+            }
 
             return result;
         }
@@ -3442,7 +4258,7 @@ not_call(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t
 
             if (not_strip_destroy(strip_copy) < 0)
             {
-                if (result != NOT_PTR_ERROR)
+                if ((result != NOT_PTR_ERROR) && (result != NULL))
                 {
                     not_record_link_decrease(result);
                 }
@@ -3455,6 +4271,11 @@ not_call(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t
                 return NOT_PTR_ERROR;
             }
 
+            if (result == NULL)
+            {
+                return not_call_trampoline(node, strip, applicant);
+            }
+
             return result;
         }
         else if (type->kind == NODE_KIND_KCHAR)
@@ -4059,4 +4880,126 @@ not_call(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t
 
     not_record_link_decrease(record_base);
     return NOT_PTR_ERROR;
-}
\ No newline at end of file
+}
+
+not_record_t *
+not_call(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
+{
+    not_node_carrier_t *carrier = (not_node_carrier_t *)node->value;
+
+    not_record_t *record_base = not_expression(carrier->base, strip, applicant, origin);
+    if (record_base == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    return not_call_by_record(node, record_base, strip, applicant);
+}
+
+/*
+ * Names resolve through the scopes a callee is written in. One nested in a
+ * fun, a lambda or a class finds their values in the frame that makes the
+ * tail call, which the trampoline no longer has, so it is never left pending.
+ */
+static int32_t
+not_call_tail_is_closed(not_node_t *type)
+{
+    for (not_node_t *node1 = type->parent; node1 != NULL; node1 = node1->parent)
+    {
+        if ((node1->kind == NODE_KIND_FUN) || (node1->kind == NODE_KIND_LAMBDA) || (node1->kind == NODE_KIND_CLASS))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * A call returned from the frame of the running function. When the callee
+ * is a plain fun or lambda that sees nothing of this frame, its arguments
+ * are bound here, while the frame is still alive, and the call is left
+ * pending for the trampoline of the call expression that entered this
+ * frame. Otherwise it is an ordinary call.
+ */
+int32_t
+not_call_tail(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
+{
+    not_node_carrier_t *carrier = (not_node_carrier_t *)node->value;
+
+    not_record_t *record_base = not_expression(carrier->base, strip, applicant, NULL);
+    if (record_base == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    not_node_t *parameters = NULL;
+    int32_t tail = 0;
+
+    if (record_base->kind == RECORD_KIND_TYPE)
+    {
+        not_record_type_t *record_type = (not_record_type_t *)record_base->value;
+        not_node_t *type = record_type->type;
+
+        if (type->kind == NODE_KIND_FUN)
+        {
+            not_node_fun_t *fun1 = (not_node_fun_t *)type->value;
+            if ((fun1->generics == NULL) && ((fun1->flag & SYNTAX_MODIFIER_GENERATOR) != SYNTAX_MODIFIER_GENERATOR) &&
+                not_call_tail_is_closed(type))
+            {
+                parameters = fun1->parameters;
+                tail = 1;
+            }
+        }
+        else if (type->kind == NODE_KIND_LAMBDA)
+        {
+            not_node_lambda_t *lambda1 = (not_node_lambda_t *)type->value;
+            if ((lambda1->generics == NULL) && ((lambda1->flag & SYNTAX_MODIFIER_GENERATOR) != SYNTAX_MODIFIER_GENERATOR) &&
+                not_call_tail_is_closed(type))
+            {
+                parameters = lambda1->parameters;
+                tail = 1;
+            }
+        }
+    }
+
+    if (tail == 0)
+    {
+        not_record_t *result = not_call_by_record(node, record_base, strip, applicant);
+        if (result == NOT_PTR_ERROR)
+        {
+            return -1;
+        }
+
+        *rax = result;
+        return -5;
+    }
+
+    not_record_type_t *record_type = (not_record_type_t *)record_base->value;
+
+    not_strip_t *strip_copy = not_strip_copy((not_strip_t *)record_type->value);
+    if (strip_copy == NOT_PTR_ERROR)
+    {
+        not_record_link_decrease(record_base);
+        return -1;
+    }
+
+    /* arguments see the callee closure first and then the caller, as in a call */
+    not_strip_attach(strip_copy, strip);
+
+    if (not_call_parameters_subs(node, record_type->type, strip_copy, parameters, carrier->data, applicant) < 0)
+    {
+        not_strip_detach(strip_copy, strip);
+        not_strip_destroy(strip_copy);
+        not_record_link_decrease(record_base);
+        return -1;
+    }
+
+    not_strip_detach(strip_copy, strip);
+
+    not_interpreter_t *interpreter = not_thread_get_interpreter();
+    interpreter->tail = record_base;
+    interpreter->tail_strip = strip_copy;
+
+    return -6;
+}
@@ -469,6 +469,40 @@ not_equality_eq(not_node_t *node, not_record_t *left, not_record_t *right, not_n
     return not_record_make_int_from_si(0);
 }
 
+/*
+ * Same-kind numeric operands proven by the typing pass compare directly,
+ * NULL leaves every other pairing to the generic equality.
+ */
+static not_record_t *
+not_equality_typed(not_node_t *node, not_record_t *left, not_record_t *right)
+{
+    if ((left->kind != right->kind) || left->null || left->undefined || left->nan || right->null || right->undefined || right->nan)
+    {
+        return NULL;
+    }
+
+    int32_t cmp = 0;
+    if (left->kind == RECORD_KIND_INT)
+    {
+        cmp = mpz_cmp((*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+    }
+    else if (left->kind == RECORD_KIND_FLOAT)
+    {
+        cmp = mpf_cmp((*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+    }
+    else
+    {
+        return NULL;
+    }
+
+    if (node->kind == NODE_KIND_EQ)
+    {
+        return not_record_make_int_from_si(cmp == 0);
+    }
+
+    return not_record_make_int_from_si(cmp != 0);
+}
+
 not_record_t *
 not_equality(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
@@ -488,7 +522,16 @@ not_equality(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_no
             return NOT_PTR_ERROR;
         }
 
-        not_record_t *record = not_equality_eq(node, left, right, applicant);
+        not_record_t *record = NULL;
+        if (binary->typed != NODE_TYPED_NONE)
+        {
+            record = not_equality_typed(node, left, right);
+        }
+
+        if (record == NULL)
+        {
+            record = not_equality_eq(node, left, right, applicant);
+        }
 
         if (not_record_link_decrease(left) < 0)
         {
@@ -518,6 +561,25 @@ not_equality(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_no
             return NOT_PTR_ERROR;
         }
 
+        if (binary->typed != NODE_TYPED_NONE)
+        {
+            not_record_t *record = not_equality_typed(node, left, right);
+            if (record != NULL)
+            {
+                if (not_record_link_decrease(left) < 0)
+                {
+                    return NOT_PTR_ERROR;
+                }
+
+                if (not_record_link_decrease(right) < 0)
+                {
+                    return NOT_PTR_ERROR;
+                }
+
+                return record;
+            }
+        }
+
         not_record_t *record = not_equality_eq(node, left, right, applicant);
 
         if (not_record_link_decrease(left) < 0)
@@ -562,3 +624,72 @@ not_equality(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_no
         return not_relational(node, strip, applicant, origin);
     }
 }
+
+/*
+ * An equality that only decides a branch, answers 1 or 0 without boxing
+ * the result and reads a literal operand without parsing it, -1 on error.
+ */
+int32_t
+not_equality_branch(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+{
+    not_node_binary_t *binary = (not_node_binary_t *)node->value;
+    not_record_t *left = not_primary_operand(binary->left, strip, applicant, NULL);
+    if (left == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    not_record_t *right = not_primary_right_operand(binary->right, left, strip, applicant, NULL);
+    if (right == NOT_PTR_ERROR)
+    {
+        not_record_link_decrease(left);
+        return -1;
+    }
+
+    int32_t truthy = -1;
+    if ((left->kind == right->kind) && !left->null && !left->undefined && !left->nan && !right->null && !right->undefined && !right->nan &&
+        ((left->kind == RECORD_KIND_INT) || (left->kind == RECORD_KIND_FLOAT)))
+    {
+        int32_t cmp = 0;
+        if (left->kind == RECORD_KIND_INT)
+        {
+            cmp = mpz_cmp((*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+        }
+        else
+        {
+            cmp = mpf_cmp((*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+        }
+
+        truthy = (node->kind == NODE_KIND_EQ) ? (cmp == 0) : (cmp != 0);
+    }
+    else
+    {
+        not_record_t *record = not_equality_eq(node, left, right, applicant);
+        if (record != NOT_PTR_ERROR)
+        {
+            truthy = not_execute_truthy(record);
+            if (node->kind == NODE_KIND_NEQ)
+            {
+                truthy = !truthy;
+            }
+
+            if (not_record_link_decrease(record) < 0)
+            {
+                truthy = -1;
+            }
+        }
+    }
+
+    if (not_record_link_decrease(left) < 0)
+    {
+        not_record_link_decrease(right);
+        return -1;
+    }
+
+    if (not_record_link_decrease(right) < 0)
+    {
+        return -1;
+    }
+
+    return truthy;
+}
@@ -35,7 +35,7 @@
 #include "execute.h"
 
 static int32_t
-not_execute_body(not_node_t *node, not_strip_t *strip, not_node_t *applicant);
+not_execute_body(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax);
 
 int32_t
 not_execute_truthy(not_record_t *left)
@@ -105,10 +105,50 @@ not_execute_truthy(not_record_t *left)
     {
         return 1;
     }
+    else if (left->kind == RECORD_KIND_RANGE)
+    {
+        not_record_range_t *range = (not_record_range_t *)left->value;
+        return range->step > 0 ? (range->start < range->stop) : (range->start > range->stop);
+    }
+    else if (left->kind == RECORD_KIND_GENERATOR)
+    {
+        return 1;
+    }
 
     return 0;
 }
 
+/*
+ * A loop or if condition, a comparison decides the branch without boxing
+ * its result. 1 or 0, -1 on error.
+ */
+static int32_t
+not_execute_condition(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+{
+    if ((node->kind == NODE_KIND_LT) || (node->kind == NODE_KIND_LE) || (node->kind == NODE_KIND_GT) || (node->kind == NODE_KIND_GE))
+    {
+        return not_relational_branch(node, strip, applicant);
+    }
+    else if ((node->kind == NODE_KIND_EQ) || (node->kind == NODE_KIND_NEQ))
+    {
+        return not_equality_branch(node, strip, applicant);
+    }
+
+    not_record_t *condition = not_expression(node, strip, applicant, NULL);
+    if (condition == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    int32_t truthy = not_execute_truthy(condition);
+    if (not_record_link_decrease(condition) < 0)
+    {
+        return -1;
+    }
+
+    return truthy;
+}
+
 int32_t
 not_execute_type_check_by_type(not_node_t *node, not_record_t *record_type1, not_record_t *record_type2)
 {
@@ -821,6 +861,136 @@ not_execute_value_check_by_value(not_node_t *node, not_record_t *record_value1,
     return 0;
 }
 
+#define NOT_EXECUTE_CHECK_SIZE 4
+
+/*
+ * Per-site memory of a declared type: the type record when it is a keyword
+ * type, and the results of value checks that depend only on the kind of the
+ * value, its class and the declared type.
+ */
+typedef struct not_execute_check
+{
+    not_record_t *type;
+    size_t count;
+    struct
+    {
+        uint64_t kind;
+        not_node_t *class;
+        not_node_t *type;
+        int32_t result;
+    } entries[NOT_EXECUTE_CHECK_SIZE];
+} not_execute_check_t;
+
+static not_execute_check_t *
+not_execute_check_get(void **check)
+{
+    if (*check == NULL)
+    {
+        not_execute_check_t *created = (not_execute_check_t *)not_memory_calloc(1, sizeof(not_execute_check_t));
+        if (created == NULL)
+        {
+            not_error_no_memory();
+            return NOT_PTR_ERROR;
+        }
+        *check = created;
+    }
+
+    return (not_execute_check_t *)*check;
+}
+
+not_record_t *
+not_execute_type_by_site(not_node_t *node, void **check, not_strip_t *strip, not_node_t *applicant)
+{
+    not_execute_check_t *cache = (not_execute_check_t *)*check;
+    if (cache && cache->type)
+    {
+        not_record_link_increase(cache->type);
+        return cache->type;
+    }
+
+    not_record_t *record_type = not_expression(node, strip, applicant, NULL);
+    if (record_type == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    /* keyword types evaluate to the same type wherever they are, kept for the life of the program */
+    if ((record_type->kind == RECORD_KIND_TYPE) &&
+        ((node->kind == NODE_KIND_KINT) || (node->kind == NODE_KIND_KFLOAT) ||
+         (node->kind == NODE_KIND_KCHAR) || (node->kind == NODE_KIND_KSTRING)))
+    {
+        cache = not_execute_check_get(check);
+        if (cache == NOT_PTR_ERROR)
+        {
+            not_record_link_decrease(record_type);
+            return NOT_PTR_ERROR;
+        }
+
+        not_record_link_increase(record_type);
+        cache->type = record_type;
+    }
+
+    return record_type;
+}
+
+int32_t
+not_execute_value_check_by_site(not_node_t *node, void **check, not_record_t *record_value, not_record_t *record_type)
+{
+    not_record_type_t *type1 = (not_record_type_t *)record_type->value;
+    not_node_t *type = type1->type;
+
+    /* the shape of objects and tuples and the generics of a class are not part of the key */
+    if ((type->kind == NODE_KIND_OBJECT) || (type->kind == NODE_KIND_ARRAY) || (type->kind == NODE_KIND_TUPLE))
+    {
+        return not_execute_value_check_by_type(node, record_value, record_type);
+    }
+    else if ((type->kind == NODE_KIND_CLASS) && ((not_node_class_t *)type->value)->generics)
+    {
+        return not_execute_value_check_by_type(node, record_value, record_type);
+    }
+
+    not_node_t *class1 = NULL;
+    if (record_value->kind == RECORD_KIND_STRUCT)
+    {
+        class1 = ((not_record_struct_t *)record_value->value)->type;
+    }
+
+    not_execute_check_t *cache = (not_execute_check_t *)*check;
+    if (cache)
+    {
+        for (size_t i = 0; i < cache->count; i++)
+        {
+            if ((cache->entries[i].kind == record_value->kind) && (cache->entries[i].class == class1) && (cache->entries[i].type == type))
+            {
+                return cache->entries[i].result;
+            }
+        }
+    }
+
+    int32_t r1 = not_execute_value_check_by_type(node, record_value, record_type);
+    if (r1 < 0)
+    {
+        return r1;
+    }
+
+    cache = not_execute_check_get(check);
+    if (cache == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    if (cache->count < NOT_EXECUTE_CHECK_SIZE)
+    {
+        cache->entries[cache->count].kind = record_value->kind;
+        cache->entries[cache->count].class = class1;
+        cache->entries[cache->count].type = type;
+        cache->entries[cache->count].result = r1;
+        cache->count += 1;
+    }
+
+    return r1;
+}
+
 not_record_t *
 not_execute_value_casting_by_type(not_node_t *node, not_record_t *record_value, not_record_t *record_type)
 {
@@ -1552,7 +1722,7 @@ not_execute_var(not_node_t *scope, not_node_t *node, not_strip_t *strip, not_nod
 
         if (var1->type)
         {
-            not_record_t *record_type = not_expression(var1->type, strip, applicant, NULL);
+            not_record_t *record_type = not_execute_type_by_site(var1->type, &var1->check, strip, applicant);
             if (record_type == NOT_PTR_ERROR)
             {
                 if (not_record_link_decrease(record_value) < 0)
@@ -1582,7 +1752,7 @@ not_execute_var(not_node_t *scope, not_node_t *node, not_strip_t *strip, not_nod
                 return -1;
             }
 
-            int32_t r1 = not_execute_value_check_by_type(var1->key, record_value, record_type);
+            int32_t r1 = not_execute_value_check_by_site(var1->key, &var1->check, record_value, record_type);
             if (r1 < 0)
             {
                 if (not_record_link_decrease(record_type) < 0)
@@ -1753,8 +1923,243 @@ not_execute_var(not_node_t *scope, not_node_t *node, not_strip_t *strip, not_nod
     return 0;
 }
 
+/*
+ * A counted loop keeps its counter in a native int, the counter record is
+ * written before every step and the bound is evaluated once. The names the
+ * bound reads are held with a snapshot of their value, any change to them
+ * or to the counter hands the loop back to the generic path.
+ */
+typedef struct not_execute_counted
+{
+    not_record_t *counter;
+    int64_t value;
+    int64_t bound;
+    int64_t step;
+    int32_t count;
+    not_record_t *names[NODE_FOR_COUNTED_NAMES];
+    mpz_t snapshots[NODE_FOR_COUNTED_NAMES];
+} not_execute_counted_t;
+
+static int32_t
+not_execute_counted_plain(not_record_t *record)
+{
+    return (record->kind == RECORD_KIND_INT) && !record->null && !record->undefined && !record->nan &&
+           mpz_fits_slong_p(*(mpz_t *)(record->value));
+}
+
+static int32_t
+not_execute_counted_release(not_execute_counted_t *counted)
+{
+    int32_t result = 0;
+
+    for (int32_t i = 0; i < counted->count; i++)
+    {
+        mpz_clear(counted->snapshots[i]);
+        if (not_record_link_decrease(counted->names[i]) < 0)
+        {
+            result = -1;
+        }
+    }
+    counted->count = 0;
+
+    if (not_record_link_decrease(counted->counter) < 0)
+    {
+        result = -1;
+    }
+    counted->counter = NULL;
+
+    return result;
+}
+
+static int32_t
+not_execute_counted_names(not_execute_counted_t *counted, not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+{
+    if (node->kind == NODE_KIND_ID)
+    {
+        if (counted->count >= NODE_FOR_COUNTED_NAMES)
+        {
+            return 0;
+        }
+
+        not_record_t *record = not_expression(node, strip, applicant, NULL);
+        if (record == NOT_PTR_ERROR)
+        {
+            return -1;
+        }
+
+        if (!not_execute_counted_plain(record))
+        {
+            if (not_record_link_decrease(record) < 0)
+            {
+                return -1;
+            }
+            return 0;
+        }
+
+        counted->names[counted->count] = record;
+        mpz_init_set(counted->snapshots[counted->count], *(mpz_t *)(record->value));
+        counted->count += 1;
+        return 1;
+    }
+    else if (node->kind == NODE_KIND_PARENTHESIS)
+    {
+        not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+        return not_execute_counted_names(counted, unary1->right, strip, applicant);
+    }
+    else if ((node->kind == NODE_KIND_PLUS) || (node->kind == NODE_KIND_MINUS) || (node->kind == NODE_KIND_MUL))
+    {
+        not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+        int32_t r1 = not_execute_counted_names(counted, binary1->left, strip, applicant);
+        if (r1 <= 0)
+        {
+            return r1;
+        }
+        return not_execute_counted_names(counted, binary1->right, strip, applicant);
+    }
+
+    return 1;
+}
+
+/*
+ * 1 when the loop runs on the native counter, 0 when a runtime value does
+ * not fit the shape the typing pass saw, -1 on error.
+ */
 static int32_t
-not_execute_for(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_counted_begin(not_node_for_t *for1, not_execute_counted_t *counted, not_strip_t *strip, not_node_t *applicant)
+{
+    counted->counter = NULL;
+    counted->count = 0;
+
+    not_node_binary_t *binary1 = (not_node_binary_t *)for1->condition->value;
+    not_record_t *counter = not_expression(binary1->left, strip, applicant, NULL);
+    if (counter == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+    counted->counter = counter;
+
+    if (!not_execute_counted_plain(counter) || counter->readonly || counter->reference)
+    {
+        return not_execute_counted_release(counted);
+    }
+    counted->value = mpz_get_si(*(mpz_t *)(counter->value));
+
+    int32_t r1 = not_execute_counted_names(counted, binary1->right, strip, applicant);
+    if (r1 <= 0)
+    {
+        if (not_execute_counted_release(counted) < 0)
+        {
+            return -1;
+        }
+        return r1;
+    }
+
+    not_record_t *bound = not_expression(binary1->right, strip, applicant, NULL);
+    if (bound == NOT_PTR_ERROR)
+    {
+        not_execute_counted_release(counted);
+        return -1;
+    }
+
+    int32_t usable = not_execute_counted_plain(bound);
+    if (usable)
+    {
+        counted->bound = mpz_get_si(*(mpz_t *)(bound->value));
+    }
+
+    if (not_record_link_decrease(bound) < 0)
+    {
+        not_execute_counted_release(counted);
+        return -1;
+    }
+
+    not_node_binary_t *binary2 = (not_node_binary_t *)for1->incrementor->value;
+    not_record_t *step = not_primary_operand(binary2->right, strip, applicant, NULL);
+    if (step == NOT_PTR_ERROR)
+    {
+        not_execute_counted_release(counted);
+        return -1;
+    }
+
+    usable = usable && not_execute_counted_plain(step);
+    if (usable)
+    {
+        counted->step = mpz_get_si(*(mpz_t *)(step->value));
+        if (for1->incrementor->kind == NODE_KIND_SUB_ASSIGN)
+        {
+            counted->step = -counted->step;
+        }
+    }
+
+    if (not_record_link_decrease(step) < 0)
+    {
+        not_execute_counted_release(counted);
+        return -1;
+    }
+
+    if (!usable)
+    {
+        return not_execute_counted_release(counted);
+    }
+
+    return 1;
+}
+
+static int32_t
+not_execute_counted_test(not_node_t *condition, not_execute_counted_t *counted)
+{
+    if (condition->kind == NODE_KIND_LT)
+    {
+        return counted->value < counted->bound;
+    }
+    else if (condition->kind == NODE_KIND_LE)
+    {
+        return counted->value <= counted->bound;
+    }
+    else if (condition->kind == NODE_KIND_GT)
+    {
+        return counted->value > counted->bound;
+    }
+
+    return counted->value >= counted->bound;
+}
+
+/*
+ * Whether the step can stay native: nothing wrote the counter or a name of
+ * the bound, and the next value still fits.
+ */
+static int32_t
+not_execute_counted_step(not_execute_counted_t *counted)
+{
+    not_record_t *counter = counted->counter;
+    if ((counter->kind != RECORD_KIND_INT) || counter->null || counter->undefined || counter->nan ||
+        (mpz_cmp_si(*(mpz_t *)(counter->value), counted->value) != 0))
+    {
+        return 0;
+    }
+
+    for (int32_t i = 0; i < counted->count; i++)
+    {
+        not_record_t *record = counted->names[i];
+        if ((record->kind != RECORD_KIND_INT) || record->null || record->undefined || record->nan ||
+            (mpz_cmp(*(mpz_t *)(record->value), counted->snapshots[i]) != 0))
+        {
+            return 0;
+        }
+    }
+
+    if (((counted->step > 0) && (counted->value > INT64_MAX - counted->step)) ||
+        ((counted->step < 0) && (counted->value < INT64_MIN - counted->step)))
+    {
+        return 0;
+    }
+
+    counted->value += counted->step;
+    return 1;
+}
+
+static int32_t
+not_execute_for(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_for_t *for1 = (not_node_for_t *)node->value;
     int32_t ret_code = 0;
@@ -1784,19 +2189,29 @@ not_execute_for(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
 
     int32_t truthy = 1;
 
-region_start_loop:
-    if (for1->condition)
+    not_execute_counted_t counted;
+    int32_t fast = 0;
+    if (for1->counted == 1)
     {
-        not_record_t *condition = not_expression(for1->condition, strip, applicant, NULL);
-        if (condition == NOT_PTR_ERROR)
+        fast = not_execute_counted_begin(for1, &counted, strip, applicant);
+        if (fast < 0)
         {
-            goto region_error;
+            return -1;
         }
+    }
 
-        truthy = not_execute_truthy(condition);
-        if (not_record_link_decrease(condition) < 0)
+region_start_loop:
+    if (fast)
+    {
+        truthy = not_execute_counted_test(for1->condition, &counted);
+        mpz_set_si(*(mpz_t *)(counted.counter->value), counted.value);
+    }
+    else if (for1->condition)
+    {
+        truthy = not_execute_condition(for1->condition, strip, applicant);
+        if (truthy < 0)
         {
-            return -1;
+            goto region_error;
         }
     }
 
@@ -1804,7 +2219,7 @@ region_start_loop:
     {
         if (for1->body)
         {
-            int32_t r2 = not_execute_body(for1->body, strip, applicant);
+            int32_t r2 = not_execute_body(for1->body, strip, applicant, rax);
             if (r2 == -1)
             {
                 goto region_error;
@@ -1812,27 +2227,22 @@ region_start_loop:
             else if (r2 == -2)
             {
                 ret_code = -2;
-                not_record_t *rax = not_thread_get_rax();
-                if (rax == NOT_PTR_ERROR)
-                {
-                    goto region_error;
-                }
-
-                if (rax)
+                not_record_t *label = *rax;
+                if (label)
                 {
                     if (for1->key)
                     {
-                        not_record_type_t *type = (not_record_type_t *)rax->value;
+                        not_record_type_t *type = (not_record_type_t *)label->value;
                         if (type->type->kind == NODE_KIND_FOR)
                         {
                             not_node_for_t *for2 = (not_node_for_t *)type->type->value;
                             if (not_helper_id_cmp(for1->key, for2->key) == 0)
                             {
-                                if (not_record_link_decrease(rax) < 0)
+                                if (not_record_link_decrease(label) < 0)
                                 {
                                     goto region_error;
                                 }
-                                not_thread_set_rax(NULL);
+                                *rax = NULL;
                                 ret_code = 0;
                             }
                         }
@@ -1850,27 +2260,22 @@ region_start_loop:
             {
                 ret_code = -3;
 
-                not_record_t *rax = not_thread_get_rax();
-                if (rax == NOT_PTR_ERROR)
-                {
-                    goto region_error;
-                }
-
-                if (rax)
+                not_record_t *label = *rax;
+                if (label)
                 {
                     if (for1->key)
                     {
-                        not_record_type_t *type = (not_record_type_t *)rax->value;
+                        not_record_type_t *type = (not_record_type_t *)label->value;
                         if (type->type->kind == NODE_KIND_FOR)
                         {
                             not_node_for_t *for2 = (not_node_for_t *)type->type->value;
                             if (not_helper_id_cmp(for1->key, for2->key) == 0)
                             {
-                                if (not_record_link_decrease(rax) < 0)
+                                if (not_record_link_decrease(label) < 0)
                                 {
                                     goto region_error;
                                 }
-                                not_thread_set_rax(NULL);
+                                *rax = NULL;
                                 ret_code = 0;
 
                                 goto region_continue_loop;
@@ -1894,6 +2299,21 @@ region_start_loop:
         }
 
     region_continue_loop:
+        if (fast)
+        {
+            if (not_execute_counted_step(&counted))
+            {
+                goto region_start_loop;
+            }
+
+            /* an assumption broke, the rest of the loop runs generically */
+            fast = 0;
+            if (not_execute_counted_release(&counted) < 0)
+            {
+                goto region_error;
+            }
+        }
+
         if (for1->incrementor)
         {
             for (not_node_t *item1 = for1->incrementor; item1 != NULL; item1 = item1->next)
@@ -1910,6 +2330,15 @@ region_start_loop:
     }
 
 region_end_loop:
+    if (fast)
+    {
+        fast = 0;
+        if (not_execute_counted_release(&counted) < 0)
+        {
+            return -1;
+        }
+    }
+
     if (not_strip_variable_remove_by_scope(strip, node) < 0)
     {
         return -1;
@@ -1918,43 +2347,124 @@ region_end_loop:
     return ret_code;
 
 region_error:
+    if (fast)
+    {
+        not_execute_counted_release(&counted);
+    }
     return -1;
 }
 
 static int32_t
-not_execute_forin(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_forin_view(not_record_t **record, uint64_t kind, void *value, not_record_t *parent)
 {
-    not_node_forin_t *for1 = (not_node_forin_t *)node->value;
-    int32_t ret_code = 0;
+    not_record_t *current = *record;
 
-    not_record_t *iterator = not_expression(for1->iterator, strip, applicant, NULL);
-    if (iterator == NOT_PTR_ERROR)
+    /* the loop variable of the previous step is rebound when nothing else holds it */
+    if (current && (current->link == 1) && (current->kind == kind) && (current->reference == 1) &&
+        (current->parent == parent) && !current->null && !current->undefined && !current->nan)
     {
-        return -1;
+        current->value = value;
     }
-
-    not_record_object_t *object = NULL;
-    not_record_tuple_t *tuple = NULL;
-    size_t index = 0;
-    int no_iterable = 0;
-region_start_loop:
-    if (iterator->kind == RECORD_KIND_OBJECT)
+    else
     {
-        if (object)
+        *record = NULL;
+        if (not_record_link_decrease(current) < 0)
         {
-            object = object->next;
+            return -1;
         }
-        else
+
+        current = not_record_make_view(kind, value, parent);
+        if (current == NOT_PTR_ERROR)
         {
-            object = (not_record_object_t *)iterator->value;
+            return -1;
+        }
+        *record = current;
+    }
+
+    not_record_link_increase(current);
+    return 0;
+}
+
+static int32_t
+not_execute_forin_key(not_record_t **record, char *key)
+{
+    not_record_t *current = *record;
+
+    /* keys can outlive the object, so the loop variable owns a copy */
+    if (current && (current->link == 1) && (current->kind == RECORD_KIND_STRING) && (current->reference == 0) &&
+        !current->null && !current->undefined && !current->nan)
+    {
+        void *ptr = not_memory_realloc(current->value, strlen(key) + 1);
+        if (ptr == NULL)
+        {
+            not_error_no_memory();
+            return -1;
+        }
+        strcpy((char *)ptr, key);
+        current->value = ptr;
+    }
+    else
+    {
+        *record = NULL;
+        if (not_record_link_decrease(current) < 0)
+        {
+            return -1;
+        }
+
+        current = not_record_make_string(key);
+        if (current == NOT_PTR_ERROR)
+        {
+            return -1;
+        }
+        *record = current;
+    }
+
+    not_record_link_increase(current);
+    return 0;
+}
+
+static int32_t
+not_execute_forin(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
+{
+    not_node_forin_t *for1 = (not_node_forin_t *)node->value;
+    int32_t ret_code = 0;
+
+    not_record_t *iterator = not_expression(for1->iterator, strip, applicant, NULL);
+    if (iterator == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    not_record_object_t *object = NULL;
+    not_record_tuple_t *tuple = NULL;
+    size_t index = 0;
+    int no_iterable = 0;
+    int64_t range_term = 0;
+    not_record_t *record_term = NULL;
+    uint8_t kind = iterator->kind;
+region_start_loop:
+    /* an iterator the body assigned a value of another kind to ends the loop */
+    if (iterator->kind != kind)
+    {
+        goto region_end_loop;
+    }
+
+    if (iterator->kind == RECORD_KIND_OBJECT)
+    {
+        if (object)
+        {
+            object = object->next;
+        }
+        else
+        {
+            object = (not_record_object_t *)iterator->value;
         }
 
         if (object)
         {
             if (for1->value)
             {
-                not_record_t *record_key = not_record_make_string(object->key);
-                if (record_key == NOT_PTR_ERROR)
+                if (not_execute_forin_key(&record_term, object->key) < 0)
                 {
                     if (not_record_link_decrease(iterator) < 0)
                     {
@@ -1962,6 +2472,7 @@ region_start_loop:
                     }
                     return -1;
                 }
+                not_record_t *record_key = record_term;
 
                 not_entry_t *entry = not_strip_variable_push(strip, node, node, for1->field, record_key);
                 if (entry == NOT_PTR_ERROR)
@@ -2139,17 +2650,41 @@ region_start_loop:
     }
     else if (iterator->kind == RECORD_KIND_STRING)
     {
+        if (index == 0)
+        {
+            /* chars view the buffer owner, which assignment to the string never replaces */
+            not_record_t *owner = not_record_view_owner(iterator);
+            if (owner == NOT_PTR_ERROR)
+            {
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
+                return -1;
+            }
+
+            not_record_link_increase(owner);
+            if (not_record_link_decrease(iterator) < 0)
+            {
+                return -1;
+            }
+            iterator = owner;
+        }
+
         char *str = (char *)iterator->value;
         str += index++;
 
         if (*str != '\0')
         {
-            not_record_t *item = not_record_create(RECORD_KIND_CHAR, str);
-            if (item == NOT_PTR_ERROR)
+            if (not_execute_forin_view(&record_term, RECORD_KIND_CHAR, str, iterator) < 0)
             {
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
                 return -1;
             }
-            item->reference = 1;
+            not_record_t *item = record_term;
 
             if (for1->value)
             {
@@ -2237,6 +2772,243 @@ region_start_loop:
             goto region_end_loop;
         }
     }
+    else if (iterator->kind == RECORD_KIND_RANGE)
+    {
+        not_record_range_t *range = (not_record_range_t *)iterator->value;
+        if (index++ == 0)
+        {
+            range_term = range->start;
+        }
+        else if ((range->step > 0) ? (range_term > INT64_MAX - range->step) : (range_term < INT64_MIN - range->step))
+        {
+            /* the next term is past the int64 bounds, so it is past stop as well */
+            goto region_end_loop;
+        }
+        else
+        {
+            range_term += range->step;
+        }
+
+        if ((range->step > 0) ? (range_term < range->stop) : (range_term > range->stop))
+        {
+            /* the body released the previous value, so it can be rewritten in place */
+            if (record_term && (record_term->link == 1) && (record_term->kind == RECORD_KIND_INT) &&
+                !record_term->null && !record_term->undefined && !record_term->nan)
+            {
+                mpz_set_si(*(mpz_t *)record_term->value, range_term);
+            }
+            else
+            {
+                if (not_record_link_decrease(record_term) < 0)
+                {
+                    return -1;
+                }
+
+                record_term = not_record_make_int_from_si(range_term);
+                if (record_term == NOT_PTR_ERROR)
+                {
+                    record_term = NULL;
+                    if (not_record_link_decrease(iterator) < 0)
+                    {
+                        return -1;
+                    }
+                    return -1;
+                }
+            }
+
+            if (for1->value)
+            {
+                not_record_t *record_key = not_record_make_undefined();
+                if (record_key == NOT_PTR_ERROR)
+                {
+                    if (not_record_link_decrease(iterator) < 0)
+                    {
+                        return -1;
+                    }
+                    return -1;
+                }
+
+                not_entry_t *entry = not_strip_variable_push(strip, node, node, for1->field, record_key);
+                if (entry == NOT_PTR_ERROR)
+                {
+                    if (not_record_link_decrease(iterator) < 0)
+                    {
+                        return -1;
+                    }
+                    return -1;
+                }
+                else if (entry == NULL)
+                {
+                    not_node_basic_t *basic1 = (not_node_basic_t *)for1->field->value;
+                    not_error_type_by_node(for1->field, "'%s' already defined",
+                                           basic1->value);
+
+                    if (not_record_link_decrease(iterator) < 0)
+                    {
+                        return -1;
+                    }
+                    return -1;
+                }
+
+                entry = not_strip_variable_push(strip, node, node, for1->value, record_term);
+                if (entry == NOT_PTR_ERROR)
+                {
+                    if (not_record_link_decrease(iterator) < 0)
+                    {
+                        return -1;
+                    }
+                    return -1;
+                }
+                else if (entry == NULL)
+                {
+                    not_node_basic_t *basic1 = (not_node_basic_t *)for1->value->value;
+                    not_error_type_by_node(for1->value, "'%s' already defined",
+                                           basic1->value);
+
+                    if (not_record_link_decrease(iterator) < 0)
+                    {
+                        return -1;
+                    }
+                    return -1;
+                }
+                not_record_link_increase(record_term);
+            }
+            else
+            {
+                not_entry_t *entry = not_strip_variable_push(strip, node, node, for1->field, record_term);
+                if (entry == NOT_PTR_ERROR)
+                {
+                    if (not_record_link_decrease(iterator) < 0)
+                    {
+                        return -1;
+                    }
+                    return -1;
+                }
+                else if (entry == NULL)
+                {
+                    not_node_basic_t *basic1 = (not_node_basic_t *)for1->field->value;
+                    not_error_type_by_node(for1->field, "'%s' already defined",
+                                           basic1->value);
+
+                    if (not_record_link_decrease(iterator) < 0)
+                    {
+                        return -1;
+                    }
+                    return -1;
+                }
+                not_record_link_increase(record_term);
+            }
+        }
+        else
+        {
+            goto region_end_loop;
+        }
+    }
+    else if (iterator->kind == RECORD_KIND_GENERATOR)
+    {
+        not_record_t *item = NULL;
+        int32_t r1 = not_generator_resume(iterator, &item);
+        if (r1 < 0)
+        {
+            if (not_record_link_decrease(iterator) < 0)
+            {
+                return -1;
+            }
+            return r1;
+        }
+        else if (r1 == 0)
+        {
+            goto region_end_loop;
+        }
+
+        if (for1->value)
+        {
+            not_record_t *record_key = not_record_make_undefined();
+            if (record_key == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(item);
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
+                return -1;
+            }
+
+            not_entry_t *entry = not_strip_variable_push(strip, node, node, for1->field, record_key);
+            if (entry == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(item);
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
+                return -1;
+            }
+            else if (entry == NULL)
+            {
+                not_node_basic_t *basic1 = (not_node_basic_t *)for1->field->value;
+                not_error_type_by_node(for1->field, "'%s' already defined",
+                                       basic1->value);
+
+                not_record_link_decrease(item);
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
+                return -1;
+            }
+
+            entry = not_strip_variable_push(strip, node, node, for1->value, item);
+            if (entry == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(item);
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
+                return -1;
+            }
+            else if (entry == NULL)
+            {
+                not_node_basic_t *basic1 = (not_node_basic_t *)for1->value->value;
+                not_error_type_by_node(for1->value, "'%s' already defined",
+                                       basic1->value);
+
+                not_record_link_decrease(item);
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
+                return -1;
+            }
+        }
+        else
+        {
+            not_entry_t *entry = not_strip_variable_push(strip, node, node, for1->field, item);
+            if (entry == NOT_PTR_ERROR)
+            {
+                not_record_link_decrease(item);
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
+                return -1;
+            }
+            else if (entry == NULL)
+            {
+                not_node_basic_t *basic1 = (not_node_basic_t *)for1->field->value;
+                not_error_type_by_node(for1->field, "'%s' already defined",
+                                       basic1->value);
+
+                not_record_link_decrease(item);
+                if (not_record_link_decrease(iterator) < 0)
+                {
+                    return -1;
+                }
+                return -1;
+            }
+        }
+    }
     else
     {
         if (no_iterable)
@@ -2299,6 +3071,7 @@ region_start_loop:
                 }
                 return -1;
             }
+            not_record_link_increase(iterator);
         }
         else
         {
@@ -2323,12 +3096,13 @@ region_start_loop:
                 }
                 return -1;
             }
+            not_record_link_increase(iterator);
         }
 
         no_iterable = 1;
     }
 
-    int32_t r2 = not_execute_body(for1->body, strip, applicant);
+    int32_t r2 = not_execute_body(for1->body, strip, applicant, rax);
     if (r2 == -1)
     {
         goto region_error;
@@ -2336,27 +3110,22 @@ region_start_loop:
     else if (r2 == -2)
     {
         ret_code = -2;
-        not_record_t *rax = not_thread_get_rax();
-        if (rax == NOT_PTR_ERROR)
-        {
-            goto region_error;
-        }
-
-        if (rax)
+        not_record_t *label = *rax;
+        if (label)
         {
             if (for1->key)
             {
-                not_record_type_t *type = (not_record_type_t *)rax->value;
+                not_record_type_t *type = (not_record_type_t *)label->value;
                 if (type->type->kind == NODE_KIND_FORIN)
                 {
                     not_node_forin_t *for2 = (not_node_forin_t *)type->type->value;
                     if (not_helper_id_cmp(for1->key, for2->key) == 0)
                     {
-                        if (not_record_link_decrease(rax) < 0)
+                        if (not_record_link_decrease(label) < 0)
                         {
                             goto region_error;
                         }
-                        not_thread_set_rax(NULL);
+                        *rax = NULL;
                         ret_code = 0;
                     }
                 }
@@ -2374,27 +3143,22 @@ region_start_loop:
     {
         ret_code = -3;
 
-        not_record_t *rax = not_thread_get_rax();
-        if (rax == NOT_PTR_ERROR)
-        {
-            goto region_error;
-        }
-
-        if (rax)
+        not_record_t *label = *rax;
+        if (label)
         {
             if (for1->key)
             {
-                not_record_type_t *type = (not_record_type_t *)rax->value;
+                not_record_type_t *type = (not_record_type_t *)label->value;
                 if (type->type->kind == NODE_KIND_FORIN)
                 {
                     not_node_forin_t *for2 = (not_node_forin_t *)type->type->value;
                     if (not_helper_id_cmp(for1->key, for2->key) == 0)
                     {
-                        if (not_record_link_decrease(rax) < 0)
+                        if (not_record_link_decrease(label) < 0)
                         {
                             goto region_error;
                         }
-                        not_thread_set_rax(NULL);
+                        *rax = NULL;
                         ret_code = 0;
 
                         goto region_continue_loop;
@@ -2434,101 +3198,111 @@ region_end_loop:
         return -1;
     }
 
+    if (not_record_link_decrease(record_term) < 0)
+    {
+        return -1;
+    }
+
     return ret_code;
 
 region_error:
+    /* an abandoned generator unwinds through here, so the loop releases what it holds */
+    not_record_link_decrease(iterator);
+    not_strip_variable_remove_by_scope(strip, node);
+    not_record_link_decrease(record_term);
     return -1;
 }
 
 static int32_t
-not_execute_try(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_try(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_try_t *try1 = (not_node_try_t *)node->value;
 
-    int32_t r2 = not_execute_body(try1->body, strip, applicant);
+    int32_t r2 = not_execute_body(try1->body, strip, applicant, rax);
     if ((r2 == -4) || (r2 == -1))
     {
         if (r2 == -1)
         {
-            if (!not_config_expection_is_enable())
+            if (!not_config_expection_is_enable() || not_generator_is_cancelled())
             {
                 return -1;
             }
         }
 
-        not_thread_t *t = not_thread_get_current();
-
-        for (not_queue_entry_t *a = t->interpreter->expections->begin, *b = NULL; a != t->interpreter->expections->end; a = b)
+        if (!try1->catchs)
         {
-            b = a->next;
-            not_record_t *expection = (not_record_t *)a->value;
+            return not_error_is_pending() ? r2 : 0;
+        }
 
-            if (try1->catchs)
+        not_node_catch_t *catch1 = (not_node_catch_t *)try1->catchs->value;
+
+        if (!catch1->parameters)
+        {
+            /* nothing binds the error, so it is never built */
+            if (!not_error_is_pending())
             {
-                not_node_catch_t *catch1 = (not_node_catch_t *)try1->catchs->value;
-                int32_t r1 = not_call_parameters_check_by_one_arg(try1->catchs, strip, catch1->parameters, expection, applicant);
-                if (r1 == -1)
-                {
-                    return -1;
-                }
-                else if (r1 == 0)
-                {
-                    continue;
-                }
+                return 0;
+            }
 
-                if (not_call_parameters_subs_by_one_arg(try1->catchs, try1->catchs, strip, catch1->parameters, expection, applicant) < 0)
-                {
-                    return -1;
-                }
+            not_error_clear();
+        }
+        else
+        {
+            not_record_t *expection = not_error_take();
+            if (expection == NOT_PTR_ERROR)
+            {
+                return -1;
+            }
+            else if (expection == NULL)
+            {
+                return 0;
+            }
 
-                if (not_record_link_decrease(expection) < 0)
-                {
-                    return -1;
-                }
+            int32_t r1 = not_call_parameters_check_by_one_arg(try1->catchs, strip, catch1->parameters, expection, applicant);
+            if (r1 <= 0)
+            {
+                /* a catch that does not take it passes it on unchanged */
+                not_error_throw(expection);
+                return r2;
+            }
 
+            if (not_call_parameters_subs_by_one_arg(try1->catchs, try1->catchs, strip, catch1->parameters, expection, applicant) < 0)
+            {
                 not_record_link_decrease(expection);
-                not_queue_unlink(t->interpreter->expections, a);
-                not_memory_free(a);
-
-                if (catch1->parameters)
-                {
-                    not_node_block_t *parameters = (not_node_block_t *)catch1->parameters->value;
-                    for (not_node_t *item = parameters->items; item != NULL; item = item->next)
-                    {
-                        not_node_parameter_t *parameter = (not_node_parameter_t *)item->value;
-                        not_entry_t *entry = not_strip_input_find(strip, try1->catchs, parameter->key);
-                        if (entry == NOT_PTR_ERROR)
-                        {
-                            return -1;
-                        }
+                return -1;
+            }
 
-                        if (NOT_PTR_ERROR == not_strip_variable_push(strip, entry->scope, entry->block, entry->key, entry->value))
-                        {
-                            return -1;
-                        }
-                    }
-                }
+            if (not_record_link_decrease(expection) < 0)
+            {
+                return -1;
+            }
 
-                int32_t r3 = not_execute_body(catch1->body, strip, applicant);
-                if (r3 < 0)
+            not_node_block_t *parameters = (not_node_block_t *)catch1->parameters->value;
+            for (not_node_t *item = parameters->items; item != NULL; item = item->next)
+            {
+                not_node_parameter_t *parameter = (not_node_parameter_t *)item->value;
+                not_entry_t *entry = not_strip_input_find(strip, try1->catchs, parameter->key);
+                if (entry == NOT_PTR_ERROR)
                 {
-                    return r3;
+                    return -1;
                 }
 
-                if (not_strip_variable_remove_by_scope(strip, try1->catchs) < 0)
+                if (NOT_PTR_ERROR == not_strip_variable_push(strip, entry->scope, entry->block, entry->key, entry->value))
                 {
                     return -1;
                 }
             }
-            else
-            {
-                continue;
-            }
         }
 
-        if (not_queue_count(t->interpreter->expections) > 0)
+        int32_t r3 = not_execute_body(catch1->body, strip, applicant, rax);
+        if (r3 < 0)
+        {
+            return r3;
+        }
+
+        if (not_strip_variable_remove_by_scope(strip, try1->catchs) < 0)
         {
-            return r2;
+            return -1;
         }
     }
     else if (r2 < 0)
@@ -2540,19 +3314,13 @@ not_execute_try(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
 }
 
 static int32_t
-not_execute_if(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_if(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_if_t *if1 = (not_node_if_t *)node->value;
     if (if1->condition != NULL)
     {
-        not_record_t *condition = not_expression(if1->condition, strip, applicant, NULL);
-        if (condition == NOT_PTR_ERROR)
-        {
-            return -1;
-        }
-
-        int32_t truthy = not_execute_truthy(condition);
-        if (not_record_link_decrease(condition) < 0)
+        int32_t truthy = not_execute_condition(if1->condition, strip, applicant);
+        if (truthy < 0)
         {
             return -1;
         }
@@ -2565,7 +3333,7 @@ not_execute_if(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
 
     if (if1->then_body != NULL)
     {
-        int32_t r1 = not_execute_body(if1->then_body, strip, applicant);
+        int32_t r1 = not_execute_body(if1->then_body, strip, applicant, rax);
         if (r1 < 0)
         {
             return r1;
@@ -2581,7 +3349,7 @@ region_else:
 
         if (else_body1->kind == NODE_KIND_IF)
         {
-            int32_t r1 = not_execute_if(if1->else_body, strip, applicant);
+            int32_t r1 = not_execute_if(if1->else_body, strip, applicant, rax);
             if (r1 < 0)
             {
                 return r1;
@@ -2589,7 +3357,7 @@ region_else:
         }
         else
         {
-            int32_t r1 = not_execute_body(if1->else_body, strip, applicant);
+            int32_t r1 = not_execute_body(if1->else_body, strip, applicant, rax);
             if (r1 < 0)
             {
                 return r1;
@@ -2613,18 +3381,14 @@ not_execute_throw(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
             return -1;
         }
 
-        not_thread_t *t = not_thread_get_current();
-        if (NOT_PTR_ERROR == not_queue_right_push(t->interpreter->expections, value))
-        {
-            return -1;
-        }
+        not_error_throw(value);
     }
 
     return -4;
 }
 
 static int32_t
-not_execute_break(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_break(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_unary_t *unary = (not_node_unary_t *)node->value;
 
@@ -2655,7 +3419,7 @@ not_execute_break(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
             goto region_error;
         }
 
-        not_thread_set_rax(value);
+        *rax = value;
     }
 
     return -2;
@@ -2666,7 +3430,7 @@ region_error:
 }
 
 static int32_t
-not_execute_continue(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_continue(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_unary_t *unary = (not_node_unary_t *)node->value;
 
@@ -2697,7 +3461,7 @@ not_execute_continue(not_node_t *node, not_strip_t *strip, not_node_t *applicant
             goto region_error;
         }
 
-        not_thread_set_rax(value);
+        *rax = value;
     }
 
     return -3;
@@ -2707,27 +3471,83 @@ region_error:
     return -1;
 }
 
+/*
+ * A return sits in tail position when it runs in the frame its function
+ * was called into and no try or catch encloses it there.
+ */
 static int32_t
-not_execute_return(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_return_is_tail(not_node_t *node, not_strip_t *strip)
+{
+    not_interpreter_t *interpreter = not_thread_get_interpreter();
+    if (interpreter->frame != strip)
+    {
+        return 0;
+    }
+
+    for (not_node_t *node1 = node->parent; node1 != NULL; node1 = node1->parent)
+    {
+        if ((node1->kind == NODE_KIND_TRY) || (node1->kind == NODE_KIND_CATCH))
+        {
+            return 0;
+        }
+        else if ((node1->kind == NODE_KIND_FUN) || (node1->kind == NODE_KIND_LAMBDA))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int32_t
+not_execute_return(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_unary_t *unary = (not_node_unary_t *)node->value;
 
     if (unary->right)
     {
+        if ((unary->right->kind == NODE_KIND_CALL) && not_execute_return_is_tail(node, strip))
+        {
+            return not_call_tail(unary->right, strip, applicant, rax);
+        }
+
         not_record_t *value = not_expression(unary->right, strip, applicant, NULL);
         if (value == NOT_PTR_ERROR)
         {
             return -1;
         }
 
-        not_thread_set_rax(value);
+        *rax = value;
     }
 
     return -5;
 }
 
 static int32_t
-not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_yield(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+{
+    not_node_unary_t *unary = (not_node_unary_t *)node->value;
+
+    not_record_t *value = NULL;
+    if (unary->right)
+    {
+        value = not_expression(unary->right, strip, applicant, NULL);
+    }
+    else
+    {
+        value = not_record_make_undefined();
+    }
+
+    if (value == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    return not_generator_yield(node, value);
+}
+
+static int32_t
+not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     if (node->kind == NODE_KIND_VAR)
     {
@@ -2739,7 +3559,7 @@ not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, n
     }
     else if (node->kind == NODE_KIND_FOR)
     {
-        int32_t r1 = not_execute_for(node, strip, applicant);
+        int32_t r1 = not_execute_for(node, strip, applicant, rax);
         if (r1 < 0)
         {
             return r1;
@@ -2747,7 +3567,7 @@ not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, n
     }
     else if (node->kind == NODE_KIND_FORIN)
     {
-        int32_t r1 = not_execute_forin(node, strip, applicant);
+        int32_t r1 = not_execute_forin(node, strip, applicant, rax);
         if (r1 < 0)
         {
             return r1;
@@ -2755,7 +3575,7 @@ not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, n
     }
     else if (node->kind == NODE_KIND_IF)
     {
-        int32_t r1 = not_execute_if(node, strip, applicant);
+        int32_t r1 = not_execute_if(node, strip, applicant, rax);
         if (r1 < 0)
         {
             return r1;
@@ -2763,7 +3583,7 @@ not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, n
     }
     else if (node->kind == NODE_KIND_TRY)
     {
-        int32_t r1 = not_execute_try(node, strip, applicant);
+        int32_t r1 = not_execute_try(node, strip, applicant, rax);
         if (r1 < 0)
         {
             return r1;
@@ -2771,7 +3591,7 @@ not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, n
     }
     else if (node->kind == NODE_KIND_BREAK)
     {
-        int32_t r1 = not_execute_break(node, strip, applicant);
+        int32_t r1 = not_execute_break(node, strip, applicant, rax);
         if (r1 < 0)
         {
             return r1;
@@ -2779,7 +3599,7 @@ not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, n
     }
     else if (node->kind == NODE_KIND_CONTINUE)
     {
-        int32_t r1 = not_execute_continue(node, strip, applicant);
+        int32_t r1 = not_execute_continue(node, strip, applicant, rax);
         if (r1 < 0)
         {
             return r1;
@@ -2787,7 +3607,15 @@ not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, n
     }
     else if (node->kind == NODE_KIND_RETURN)
     {
-        int32_t r1 = not_execute_return(node, strip, applicant);
+        int32_t r1 = not_execute_return(node, strip, applicant, rax);
+        if (r1 < 0)
+        {
+            return r1;
+        }
+    }
+    else if (node->kind == NODE_KIND_YIELD)
+    {
+        int32_t r1 = not_execute_yield(node, strip, applicant);
         if (r1 < 0)
         {
             return r1;
@@ -2814,13 +3642,13 @@ not_execute_statement(not_node_t *scope, not_node_t *node, not_strip_t *strip, n
 }
 
 static int32_t
-not_execute_body(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_body(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_block_t *block = (not_node_block_t *)node->value;
 
     for (not_node_t *item = block->items; item != NULL; item = item->next)
     {
-        int32_t r1 = not_execute_statement(node, item, strip, applicant);
+        int32_t r1 = not_execute_statement(node, item, strip, applicant, rax);
         if (r1 == -1)
         {
             if (not_strip_variable_remove_by_scope(strip, node) < 0)
@@ -2849,7 +3677,7 @@ not_execute_body(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
 }
 
 int32_t
-not_execute_fun(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_fun(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_fun_t *fun = (not_node_fun_t *)node->value;
 
@@ -2872,7 +3700,7 @@ not_execute_fun(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
         }
     }
 
-    int32_t r1 = not_execute_body(fun->body, strip, applicant);
+    int32_t r1 = not_execute_body(fun->body, strip, applicant, rax);
 
     if (not_strip_variable_remove_by_scope(strip, node) < 0)
     {
@@ -2885,7 +3713,7 @@ not_execute_fun(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
     }
     else if (r1 < 0)
     {
-        if (r1 == -4)
+        if ((r1 == -4) || (r1 == -6))
         {
             return r1;
         }
@@ -2901,7 +3729,7 @@ not_execute_fun(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
 }
 
 int32_t
-not_execute_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+not_execute_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax)
 {
     not_node_lambda_t *fun = (not_node_lambda_t *)node->value;
 
@@ -2926,7 +3754,7 @@ not_execute_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
 
     if (fun->body->kind == NODE_KIND_BODY)
     {
-        int32_t r1 = not_execute_body(fun->body, strip, applicant);
+        int32_t r1 = not_execute_body(fun->body, strip, applicant, rax);
 
         if (not_strip_variable_remove_by_scope(strip, node) < 0)
         {
@@ -2939,7 +3767,7 @@ not_execute_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
         }
         else if (r1 < 0)
         {
-            if (r1 == -4)
+            if ((r1 == -4) || (r1 == -6))
             {
                 return r1;
             }
@@ -2960,7 +3788,7 @@ not_execute_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
             return -1;
         }
 
-        not_thread_set_rax(value);
+        *rax = value;
 
         if (not_strip_variable_remove_by_scope(strip, node) < 0)
         {
@@ -2994,9 +3822,17 @@ not_execute_module(not_node_t *node)
         }
         else
         {
-            int32_t r = not_execute_statement(node, item, strip, node);
+            not_record_t *rax = NULL;
+            int32_t r = not_execute_statement(node, item, strip, node, &rax);
             if (r < 0)
             {
+                /* a return or a labeled break at module level carries nothing anywhere */
+                if (rax && (not_record_link_decrease(rax) < 0))
+                {
+                    not_strip_destroy(strip);
+                    return -1;
+                }
+
                 if (not_strip_destroy(strip) < 0)
                 {
                     return -1;
@@ -14,14 +14,38 @@ not_execute_value_check_by_type(not_node_t *node, not_record_t *record_value, no
 not_record_t *
 not_execute_value_casting_by_type(not_node_t *node, not_record_t *record_value, not_record_t *record_type);
 
+not_record_t *
+not_execute_type_by_site(not_node_t *node, void **check, not_strip_t *strip, not_node_t *applicant);
+
+int32_t
+not_execute_value_check_by_site(not_node_t *node, void **check, not_record_t *record_value, not_record_t *record_type);
+
 int32_t
 not_execute_value_check_by_value(not_node_t *node, not_record_t *record_value1, not_record_t *record_value2);
 
 int32_t
-not_execute_fun(not_node_t *node, not_strip_t *strip, not_node_t *applicant);
+not_execute_fun(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax);
 
 int32_t
-not_execute_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant);
+not_execute_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax);
+
+not_record_t *
+not_generator_create(not_node_t *type, not_strip_t *strip, not_node_t *applicant);
+
+int32_t
+not_generator_resume(not_record_t *record, not_record_t **value);
+
+int32_t
+not_generator_yield(not_node_t *node, not_record_t *value);
+
+int32_t
+not_generator_destroy(not_record_generator_t *generator);
+
+int32_t
+not_generator_unlink(not_node_t *node, not_record_generator_t *generator);
+
+int32_t
+not_generator_is_cancelled();
 
 int32_t
 not_call_parameters_subs(not_node_t *base, not_node_t *scope, not_strip_t *strip, not_node_t *parameters, not_node_t *arguments, not_node_t *applicant);
@@ -35,6 +59,12 @@ not_call_parameters_subs_by_one_arg(not_node_t *base, not_node_t *scope, not_str
 not_record_t *
 not_call_operator_by_one_arg(not_node_t *base, not_record_t *content, not_record_t *arg, const char *operator, not_node_t * applicant);
 
+uint64_t
+not_call_class_layout(not_node_t *node);
+
+not_record_t *
+not_call_by_one_arg(not_node_t *base, not_record_t *content, not_record_t *arg, not_strip_t *strip, not_node_t *applicant);
+
 int32_t
 not_execute_run(not_node_t *root);
 
@@ -56,9 +86,15 @@ not_bitwise_and(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not
 not_record_t *
 not_equality(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
 
+int32_t
+not_equality_branch(not_node_t *node, not_strip_t *strip, not_node_t *applicant);
+
 not_record_t *
 not_relational(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
 
+int32_t
+not_relational_branch(not_node_t *node, not_strip_t *strip, not_node_t *applicant);
+
 not_record_t *
 not_shifting(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
 
@@ -74,9 +110,15 @@ not_power(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_
 not_record_t *
 not_prefix(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
 
+not_record_t *
+not_prefix_typeof_operand(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
+
 not_record_t *
 not_call(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
 
+int32_t
+not_call_tail(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_record_t **rax);
+
 not_record_t *
 not_array(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
 
@@ -89,6 +131,12 @@ not_attribute(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_n
 not_record_t *
 not_primary(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
 
+not_record_t *
+not_primary_operand(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
+
+not_record_t *
+not_primary_right_operand(not_node_t *node, not_record_t *left, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
+
 not_record_t *
 not_postfix(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
 
@@ -131,6 +179,11 @@ not_addative_plus(not_node_t *node, not_record_t *left, not_record_t *right, not
 not_record_t *
 not_addative_minus(not_node_t *node, not_record_t *left, not_record_t *right, not_node_t *applicant);
 
+not_record_t *
+not_addative_scratch(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin);
+
+void not_addative_release();
+
 not_record_t *
 not_execute_lor(not_node_t *node, not_record_t *left, not_record_t *right, not_node_t *applicant);
 
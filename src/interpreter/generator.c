@@ -0,0 +1,422 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <assert.h>
+#include <gmp.h>
+#include <mpfr.h>
+#include <stdint.h>
+#include <float.h>
+#include <jansson.h>
+#include <ffi.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <ucontext.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "../types/types.h"
+#include "../container/queue.h"
+#include "../token/position.h"
+#include "../token/token.h"
+#include "../ast/node.h"
+#include "../utils/utils.h"
+#include "../utils/path.h"
+#include "../error.h"
+#include "../mutex.h"
+#include "../memory.h"
+#include "../config.h"
+#include "../scanner/scanner.h"
+#include "../parser/syntax/syntax.h"
+#include "record.h"
+#include "../repository.h"
+#include "../interpreter.h"
+#include "../thread.h"
+#include "symbol_table.h"
+#include "strip.h"
+#include "entry.h"
+#include "helper.h"
+#include "execute.h"
+
+#define NOT_GENERATOR_STACK_SIZE (4 * 1024 * 1024)
+
+typedef enum not_generator_state
+{
+    GENERATOR_STATE_CREATED,
+    GENERATOR_STATE_SUSPENDED,
+    GENERATOR_STATE_RUNNING,
+    GENERATOR_STATE_DONE
+} not_generator_state_t;
+
+typedef struct not_generator_context
+{
+    not_record_generator_t *generator;
+    struct not_generator_context *previous;
+
+    not_record_t *value;
+    int32_t state;
+    int32_t status;
+    int32_t cancel;
+
+#if defined(_WIN32) || defined(_WIN64)
+    LPVOID fiber;
+    LPVOID caller;
+#else
+    ucontext_t context;
+    ucontext_t caller;
+    void *stack;
+    size_t guard;
+#endif
+} not_generator_context_t;
+
+#if defined(_WIN32) || defined(_WIN64)
+static VOID CALLBACK
+not_generator_entry(LPVOID parameter)
+#else
+static void
+not_generator_entry()
+#endif
+{
+    not_interpreter_t *interpreter = not_thread_get_interpreter();
+    not_generator_context_t *context = (not_generator_context_t *)interpreter->generator;
+    not_record_generator_t *generator = context->generator;
+
+    not_record_t *rax = NULL;
+    int32_t r1 = 0;
+    if (generator->type->kind == NODE_KIND_FUN)
+    {
+        r1 = not_execute_fun(generator->type, generator->value, generator->applicant, &rax);
+    }
+    else
+    {
+        r1 = not_execute_lambda(generator->type, generator->value, generator->applicant, &rax);
+    }
+
+    /* a generator ends on return, the returned value is not produced */
+    if (rax)
+    {
+        if (not_record_link_decrease(rax) < 0)
+        {
+            r1 = -1;
+        }
+    }
+
+    context->status = (r1 < 0) ? r1 : 0;
+    context->state = GENERATOR_STATE_DONE;
+
+#if defined(_WIN32) || defined(_WIN64)
+    SwitchToFiber(context->caller);
+#endif
+}
+
+not_record_t *
+not_generator_create(not_node_t *type, not_strip_t *strip, not_node_t *applicant)
+{
+    not_generator_context_t *context = (not_generator_context_t *)not_memory_calloc(1, sizeof(not_generator_context_t));
+    if (context == NULL)
+    {
+        not_error_no_memory();
+        return NOT_PTR_ERROR;
+    }
+
+    not_record_generator_t *generator = (not_record_generator_t *)not_memory_calloc(1, sizeof(not_record_generator_t));
+    if (generator == NULL)
+    {
+        not_error_no_memory();
+        not_memory_free(context);
+        return NOT_PTR_ERROR;
+    }
+
+    generator->type = type;
+    generator->value = strip;
+    generator->applicant = applicant;
+    generator->context = context;
+    generator->link = 1;
+
+    context->generator = generator;
+    context->state = GENERATOR_STATE_CREATED;
+
+    not_record_t *record = not_record_create(RECORD_KIND_GENERATOR, generator);
+    if (record == NOT_PTR_ERROR)
+    {
+        not_memory_free(generator);
+        not_memory_free(context);
+        return NOT_PTR_ERROR;
+    }
+
+    return record;
+}
+
+static int32_t
+not_generator_start(not_generator_context_t *context)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (!IsThreadAFiber())
+    {
+        if (ConvertThreadToFiber(NULL) == NULL)
+        {
+            not_error_system("failed to convert thread to fiber");
+            return -1;
+        }
+    }
+
+    context->fiber = CreateFiber(NOT_GENERATOR_STACK_SIZE, not_generator_entry, NULL);
+    if (context->fiber == NULL)
+    {
+        not_error_system("failed to create fiber");
+        return -1;
+    }
+#else
+    /* the lowest page stays unmapped, an overflow faults instead of corrupting the heap */
+    size_t guard = (size_t)sysconf(_SC_PAGESIZE);
+    void *stack = mmap(NULL, guard + NOT_GENERATOR_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (stack == MAP_FAILED)
+    {
+        not_error_no_memory();
+        return -1;
+    }
+
+    if (mprotect(stack, guard, PROT_NONE) < 0)
+    {
+        munmap(stack, guard + NOT_GENERATOR_STACK_SIZE);
+        not_error_system("failed to protect the generator stack");
+        return -1;
+    }
+
+    context->stack = stack;
+    context->guard = guard;
+
+    if (getcontext(&context->context) < 0)
+    {
+        munmap(context->stack, context->guard + NOT_GENERATOR_STACK_SIZE);
+        context->stack = NULL;
+        not_error_system("failed to get context");
+        return -1;
+    }
+
+    context->context.uc_stack.ss_sp = (char *)context->stack + context->guard;
+    context->context.uc_stack.ss_size = NOT_GENERATOR_STACK_SIZE;
+    context->context.uc_link = &context->caller;
+    makecontext(&context->context, not_generator_entry, 0);
+#endif
+
+    return 0;
+}
+
+static void
+not_generator_release(not_generator_context_t *context)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    if (context->fiber)
+    {
+        DeleteFiber(context->fiber);
+        context->fiber = NULL;
+    }
+#else
+    if (context->stack)
+    {
+        munmap(context->stack, context->guard + NOT_GENERATOR_STACK_SIZE);
+        context->stack = NULL;
+    }
+#endif
+}
+
+static int32_t
+not_generator_switch(not_generator_context_t *context)
+{
+    not_interpreter_t *interpreter = not_thread_get_interpreter();
+    context->previous = (not_generator_context_t *)interpreter->generator;
+    interpreter->generator = context;
+
+    context->state = GENERATOR_STATE_RUNNING;
+
+#if defined(_WIN32) || defined(_WIN64)
+    context->caller = GetCurrentFiber();
+    SwitchToFiber(context->fiber);
+#else
+    if (swapcontext(&context->caller, &context->context) < 0)
+    {
+        interpreter->generator = context->previous;
+        context->state = GENERATOR_STATE_DONE;
+        not_error_system("failed to swap context");
+        return -1;
+    }
+#endif
+
+    interpreter->generator = context->previous;
+    context->previous = NULL;
+
+    return 0;
+}
+
+int32_t
+not_generator_resume(not_record_t *record, not_record_t **value)
+{
+    not_record_generator_t *generator = (not_record_generator_t *)record->value;
+    not_generator_context_t *context = (not_generator_context_t *)generator->context;
+
+    if (context->state == GENERATOR_STATE_DONE)
+    {
+        return 0;
+    }
+    else if (context->state == GENERATOR_STATE_RUNNING)
+    {
+        not_error_runtime_by_node(generator->type, "generator already executing");
+        return -1;
+    }
+    else if (context->state == GENERATOR_STATE_CREATED)
+    {
+        if (not_generator_start(context) < 0)
+        {
+            return -1;
+        }
+    }
+
+    if (not_generator_switch(context) < 0)
+    {
+        return -1;
+    }
+
+    if (context->state == GENERATOR_STATE_SUSPENDED)
+    {
+        *value = context->value;
+        context->value = NULL;
+        return 1;
+    }
+
+    not_generator_release(context);
+
+    int32_t status = context->status;
+    context->status = 0;
+    return status;
+}
+
+int32_t
+not_generator_yield(not_node_t *node, not_record_t *value)
+{
+    not_interpreter_t *interpreter = not_thread_get_interpreter();
+    not_generator_context_t *context = (not_generator_context_t *)interpreter->generator;
+    if (context == NULL)
+    {
+        not_error_runtime_by_node(node, "'%s' outside of a running generator", "yield");
+        if (not_record_link_decrease(value) < 0)
+        {
+            return -1;
+        }
+        return -1;
+    }
+
+    if (context->cancel)
+    {
+        /* a yield reached while unwinding an abandoned generator goes nowhere */
+        if (not_record_link_decrease(value) < 0)
+        {
+            return -1;
+        }
+        return -1;
+    }
+
+    context->value = value;
+    context->state = GENERATOR_STATE_SUSPENDED;
+
+#if defined(_WIN32) || defined(_WIN64)
+    SwitchToFiber(context->caller);
+#else
+    if (swapcontext(&context->context, &context->caller) < 0)
+    {
+        not_error_system("failed to swap context");
+        return -1;
+    }
+#endif
+
+    if (context->cancel)
+    {
+        /* abandoned, the frames above unwind as on an error nobody reports */
+        return -1;
+    }
+
+    return 0;
+}
+
+int32_t
+not_generator_is_cancelled()
+{
+    not_interpreter_t *interpreter = not_thread_get_interpreter();
+    not_generator_context_t *context = (not_generator_context_t *)interpreter->generator;
+    return (context != NULL) && context->cancel;
+}
+
+/*
+ * Lets go of a generator shared by several records. The last one destroys
+ * it, which is refused while its own body is the one running.
+ */
+int32_t
+not_generator_unlink(not_node_t *node, not_record_generator_t *generator)
+{
+    if (generator->link > 1)
+    {
+        generator->link -= 1;
+        return 0;
+    }
+
+    not_generator_context_t *context = (not_generator_context_t *)generator->context;
+    if (context->state == GENERATOR_STATE_RUNNING)
+    {
+        not_error_runtime_by_node(node, "generator already executing");
+        return -1;
+    }
+
+    return not_generator_destroy(generator);
+}
+
+int32_t
+not_generator_destroy(not_record_generator_t *generator)
+{
+    not_generator_context_t *context = (not_generator_context_t *)generator->context;
+
+    if (context->value)
+    {
+        if (not_record_link_decrease(context->value) < 0)
+        {
+            return -1;
+        }
+        context->value = NULL;
+    }
+
+    if (context->state == GENERATOR_STATE_SUSPENDED)
+    {
+        /* resumed once more so its frames unwind and release what they hold */
+        context->cancel = 1;
+        if (not_generator_switch(context) < 0)
+        {
+            return -1;
+        }
+
+        if (context->value)
+        {
+            if (not_record_link_decrease(context->value) < 0)
+            {
+                return -1;
+            }
+            context->value = NULL;
+        }
+    }
+
+    not_generator_release(context);
+    not_memory_free(context);
+
+    if (generator->value)
+    {
+        if (not_strip_destroy(generator->value) < 0)
+        {
+            return -1;
+        }
+    }
+
+    not_memory_free(generator);
+    return 0;
+}
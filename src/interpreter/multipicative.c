@@ -848,11 +848,111 @@ not_multipicative_epi(not_node_t *node, not_record_t *left, not_record_t *right,
 	return not_record_make_nan();
 }
 
+/*
+ * Same-kind numeric operands proven by the typing pass; a zero divisor or
+ * any flagged operand returns NULL so the generic handler reports it.
+ */
+static not_record_t *
+not_multipicative_typed(not_node_t *node, not_record_t *left, not_record_t *right)
+{
+	if ((left->kind != right->kind) || left->null || left->undefined || left->nan || right->null || right->undefined || right->nan)
+	{
+		return NULL;
+	}
+
+	if (left->kind == RECORD_KIND_INT)
+	{
+		if ((node->kind != NODE_KIND_MUL) && (mpz_sgn((*(mpz_t *)(right->value))) == 0))
+		{
+			return NULL;
+		}
+
+		mpz_t *basic = (mpz_t *)not_memory_calloc(1, sizeof(mpz_t));
+		if (basic == NULL)
+		{
+			not_error_no_memory();
+			return NOT_PTR_ERROR;
+		}
+
+		mpz_init(*basic);
+
+		if (node->kind == NODE_KIND_MUL)
+		{
+			mpz_mul(*basic, (*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+		}
+		else if (node->kind == NODE_KIND_DIV)
+		{
+			mpz_div(*basic, (*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+		}
+		else
+		{
+			mpz_mod(*basic, (*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+		}
+
+		not_record_t *record = not_record_create(RECORD_KIND_INT, basic);
+		if (record == NOT_PTR_ERROR)
+		{
+			mpz_clear(*basic);
+			not_memory_free(basic);
+			return NOT_PTR_ERROR;
+		}
+
+		return record;
+	}
+	else if (left->kind == RECORD_KIND_FLOAT)
+	{
+		if ((node->kind != NODE_KIND_MUL) && (mpf_sgn((*(mpf_t *)(right->value))) == 0))
+		{
+			return NULL;
+		}
+
+		mpf_t *basic = (mpf_t *)not_memory_calloc(1, sizeof(mpf_t));
+		if (basic == NULL)
+		{
+			not_error_no_memory();
+			return NOT_PTR_ERROR;
+		}
+
+		mpf_init(*basic);
+
+		if (node->kind == NODE_KIND_MUL)
+		{
+			mpf_mul(*basic, (*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+		}
+		else if (node->kind == NODE_KIND_DIV)
+		{
+			mpf_div(*basic, (*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+		}
+		else
+		{
+			mpf_mod(*basic, (*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+		}
+
+		not_record_t *record = not_record_create(RECORD_KIND_FLOAT, basic);
+		if (record == NOT_PTR_ERROR)
+		{
+			mpf_clear(*basic);
+			not_memory_free(basic);
+			return NOT_PTR_ERROR;
+		}
+
+		return record;
+	}
+
+	return NULL;
+}
+
 not_record_t *
 not_multipicative(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
 	if (node->kind == NODE_KIND_MUL)
 	{
+		not_record_t *scratch = not_addative_scratch(node, strip, applicant, origin);
+		if (scratch != NULL)
+		{
+			return scratch;
+		}
+
 		not_node_binary_t *binary = (not_node_binary_t *)node->value;
 		not_record_t *left = not_multipicative(binary->left, strip, applicant, origin);
 		if (left == NOT_PTR_ERROR)
@@ -867,7 +967,16 @@ not_multipicative(not_node_t *node, not_strip_t *strip, not_node_t *applicant, n
 			return NOT_PTR_ERROR;
 		}
 
-		not_record_t *record = not_multipicative_mul(node, left, right, applicant);
+		not_record_t *record = NULL;
+		if (binary->typed != NODE_TYPED_NONE)
+		{
+			record = not_multipicative_typed(node, left, right);
+		}
+
+		if (record == NULL)
+		{
+			record = not_multipicative_mul(node, left, right, applicant);
+		}
 
 		if (not_record_link_decrease(left) < 0)
 		{
@@ -897,7 +1006,16 @@ not_multipicative(not_node_t *node, not_strip_t *strip, not_node_t *applicant, n
 			return NOT_PTR_ERROR;
 		}
 
-		not_record_t *record = not_multipicative_div(node, left, right, applicant);
+		not_record_t *record = NULL;
+		if (binary->typed != NODE_TYPED_NONE)
+		{
+			record = not_multipicative_typed(node, left, right);
+		}
+
+		if (record == NULL)
+		{
+			record = not_multipicative_div(node, left, right, applicant);
+		}
 
 		if (not_record_link_decrease(left) < 0)
 		{
@@ -927,7 +1045,16 @@ not_multipicative(not_node_t *node, not_strip_t *strip, not_node_t *applicant, n
 			return NOT_PTR_ERROR;
 		}
 
-		not_record_t *record = not_multipicative_mod(node, left, right, applicant);
+		not_record_t *record = NULL;
+		if (binary->typed != NODE_TYPED_NONE)
+		{
+			record = not_multipicative_typed(node, left, right);
+		}
+
+		if (record == NULL)
+		{
+			record = not_multipicative_mod(node, left, right, applicant);
+		}
 
 		if (not_record_link_decrease(left) < 0)
 		{
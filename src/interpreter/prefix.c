@@ -170,6 +170,62 @@ size_of(not_record_t *record, size_t *size)
     return 0;
 }
 
+static char *
+not_prefix_typeof_name(not_record_t *right)
+{
+    char *type_string = "null";
+    if (right->kind == RECORD_KIND_INT)
+    {
+        type_string = "int";
+    }
+    else if (right->kind == RECORD_KIND_FLOAT)
+    {
+        type_string = "float";
+    }
+    else if (right->kind == RECORD_KIND_CHAR)
+    {
+        type_string = "char";
+    }
+    else if (right->kind == RECORD_KIND_STRING)
+    {
+        type_string = "string";
+    }
+    else if (right->kind == RECORD_KIND_OBJECT)
+    {
+        type_string = "object";
+    }
+    else if (right->kind == RECORD_KIND_TUPLE)
+    {
+        type_string = "tuple";
+    }
+    else if (right->kind == RECORD_KIND_STRUCT)
+    {
+        type_string = "struct";
+    }
+    else if (right->kind == RECORD_KIND_TYPE)
+    {
+        type_string = "type";
+    }
+    else if (right->kind == RECORD_KIND_UNDEFINED)
+    {
+        type_string = "undefined";
+    }
+    else if (right->kind == RECORD_KIND_NAN)
+    {
+        type_string = "nan";
+    }
+    else if (right->kind == RECORD_KIND_RANGE)
+    {
+        type_string = "range";
+    }
+    else if (right->kind == RECORD_KIND_GENERATOR)
+    {
+        type_string = "generator";
+    }
+
+    return type_string;
+}
+
 not_record_t *
 not_prefix(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
@@ -337,49 +393,7 @@ not_prefix(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node
             return NOT_PTR_ERROR;
         }
 
-        char *type_string = "null";
-        if (right->kind == RECORD_KIND_INT)
-        {
-            type_string = "int";
-        }
-        else if (right->kind == RECORD_KIND_FLOAT)
-        {
-            type_string = "float";
-        }
-        else if (right->kind == RECORD_KIND_CHAR)
-        {
-            type_string = "char";
-        }
-        else if (right->kind == RECORD_KIND_STRING)
-        {
-            type_string = "string";
-        }
-        else if (right->kind == RECORD_KIND_OBJECT)
-        {
-            type_string = "object";
-        }
-        else if (right->kind == RECORD_KIND_TUPLE)
-        {
-            type_string = "tuple";
-        }
-        else if (right->kind == RECORD_KIND_STRUCT)
-        {
-            type_string = "struct";
-        }
-        else if (right->kind == RECORD_KIND_TYPE)
-        {
-            type_string = "type";
-        }
-        else if (right->kind == RECORD_KIND_UNDEFINED)
-        {
-            type_string = "undefined";
-        }
-        else if (right->kind == RECORD_KIND_NAN)
-        {
-            type_string = "nan";
-        }
-
-        not_record_t *record = not_record_make_string(type_string);
+        not_record_t *record = not_record_make_string(not_prefix_typeof_name(right));
 
         if (not_record_link_decrease(right) < 0)
         {
@@ -393,3 +407,39 @@ not_prefix(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node
         return not_postfix(node, strip, applicant, origin);
     }
 }
+
+/*
+ * typeof as an operand that is only read, the name is the immortal record
+ * interned for it. Bound or stored results come from not_prefix instead.
+ */
+not_record_t *
+not_prefix_typeof_operand(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
+{
+    not_node_unary_t *unary = (not_node_unary_t *)node->value;
+
+    not_record_t *right = not_prefix(unary->right, strip, applicant, origin);
+    if (right == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    /* keyed by the name itself, a constant of not_prefix_typeof_name */
+    char *type_string = not_prefix_typeof_name(right);
+    not_record_t *record = not_record_intern_find(type_string);
+    if (record == NULL)
+    {
+        record = not_record_intern_push(type_string, not_record_make_string(type_string));
+        if (record == NOT_PTR_ERROR)
+        {
+            not_record_link_decrease(right);
+            return NOT_PTR_ERROR;
+        }
+    }
+
+    if (not_record_link_decrease(right) < 0)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    return record;
+}
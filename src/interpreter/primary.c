@@ -45,10 +45,168 @@ not_primary_get_root(not_node_t *base)
     return base;
 }
 
+static not_record_t *
+not_primary_builtin_range(not_node_t *base, not_record_t *source, not_node_t *arguments, not_strip_t *strip, not_node_t *applicant)
+{
+    if (arguments)
+    {
+        not_node_block_t *block = (not_node_block_t *)arguments->value;
+
+        uint64_t cnt1 = 0;
+        for (not_node_t *item = block->items; item != NULL; item = item->next)
+        {
+            cnt1 += 1;
+        }
+
+        if (cnt1 > 3)
+        {
+            not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Range", 3, cnt1);
+            return NOT_PTR_ERROR;
+        }
+    }
+    else
+    {
+        not_error_type_by_node(base, "'%s' takes %lld positional arguments but %lld were given", "Range", 3, 0);
+        return NOT_PTR_ERROR;
+    }
+
+    not_record_t *return_value = NOT_PTR_ERROR;
+
+    not_node_block_t *block = (not_node_block_t *)arguments->value;
+    not_record_t *record_arg[3];
+
+    size_t array_length = sizeof(record_arg) / sizeof(record_arg[0]);
+    for (size_t i = 0; i < array_length; i++)
+    {
+        record_arg[i] = NULL;
+    }
+
+    const char *names[] = {"start", "stop", "step"};
+
+    size_t parameter_index = 0;
+    for (not_node_t *item = block->items; item != NULL; item = item->next)
+    {
+        not_node_argument_t *argument = (not_node_argument_t *)item->value;
+
+        size_t index = parameter_index;
+        not_node_t *value = argument->key;
+        if (argument->value)
+        {
+            for (index = 0; index < array_length; index++)
+            {
+                if (not_helper_id_strcmp(argument->key, names[index]) == 0)
+                {
+                    break;
+                }
+            }
+
+            if (index == array_length)
+            {
+                not_node_basic_t *basic = (not_node_basic_t *)argument->key->value;
+                not_error_type_by_node(argument->key, "'%s' got an unexpected keyword argument '%s'", "Range", basic->value);
+                goto region_cleanup;
+            }
+
+            value = argument->value;
+        }
+        else
+        {
+            parameter_index += 1;
+        }
+
+        not_record_t *arg = not_expression(value, strip, applicant, NULL);
+        if (arg == NOT_PTR_ERROR)
+        {
+            goto region_cleanup;
+        }
+
+        if (record_arg[index])
+        {
+            not_record_link_decrease(record_arg[index]);
+        }
+        record_arg[index] = arg;
+
+        if (arg->kind != RECORD_KIND_INT)
+        {
+            not_error_type_by_node(value, "'%s' mismatch: '%s' and '%s'",
+                                   names[index], not_record_type_as_string(arg), "int");
+            goto region_cleanup;
+        }
+
+        if (!mpz_fits_slong_p(*(mpz_t *)arg->value))
+        {
+            not_error_type_by_node(value, "'%s' is out of range", names[index]);
+            goto region_cleanup;
+        }
+    }
+
+    int64_t start = 0, stop = 0, step = 1;
+    if (record_arg[0] && !record_arg[1] && (parameter_index == 1))
+    {
+        /* Range(n) counts from zero up to n */
+        stop = mpz_get_si(*(mpz_t *)record_arg[0]->value);
+    }
+    else
+    {
+        if (!record_arg[1])
+        {
+            not_error_type_by_node(base, "'%s' missing '%s' required positional argument", "Range", "stop");
+            goto region_cleanup;
+        }
+
+        if (record_arg[0])
+        {
+            start = mpz_get_si(*(mpz_t *)record_arg[0]->value);
+        }
+        stop = mpz_get_si(*(mpz_t *)record_arg[1]->value);
+    }
+
+    if (record_arg[2])
+    {
+        step = mpz_get_si(*(mpz_t *)record_arg[2]->value);
+        if (step == 0)
+        {
+            not_error_type_by_node(base, "'%s' step cannot be zero", "Range");
+            goto region_cleanup;
+        }
+    }
+
+    return_value = not_record_make_range(start, stop, step);
+
+region_cleanup:
+    for (size_t i = 0; i < array_length; i++)
+    {
+        if (record_arg[i])
+        {
+            if (not_record_link_decrease(record_arg[i]) < 0)
+            {
+                if (return_value != NOT_PTR_ERROR)
+                {
+                    not_record_link_decrease(return_value);
+                }
+                return NOT_PTR_ERROR;
+            }
+        }
+    }
+
+    return return_value;
+}
+
+static not_record_t *
+not_primary_builtin(not_node_t *name)
+{
+    if (not_helper_id_strcmp(name, "Range") == 0)
+    {
+        return not_record_make_builtin(NULL, &not_primary_builtin_range);
+    }
+
+    return NULL;
+}
+
 not_record_t *
 not_primary_selection(not_node_t *base, not_node_t *sub, not_node_t *name, not_strip_t *strip, not_node_t *applicant)
 {
-    if (base->kind == NODE_KIND_CATCH)
+    if ((base->kind == NODE_KIND_CATCH) && (((not_node_catch_t *)base->value)->parameters != NULL))
     {
         not_node_catch_t *catch1 = (not_node_catch_t *)base->value;
 
@@ -279,13 +437,19 @@ not_primary_selection(not_node_t *base, not_node_t *sub, not_node_t *name, not_s
         {
             if (not_helper_id_cmp(fun1->key, name) == 0)
             {
+                not_record_t *record = not_record_intern_find(base);
+                if (record)
+                {
+                    return record;
+                }
+
                 not_strip_t *strip_copy = not_strip_create(NULL);
                 if (strip_copy == NOT_PTR_ERROR)
                 {
                     return NOT_PTR_ERROR;
                 }
 
-                return not_record_make_type(base, strip_copy);
+                return not_record_intern_push(base, not_record_make_type(base, strip_copy));
             }
         }
 
@@ -492,13 +656,19 @@ not_primary_selection(not_node_t *base, not_node_t *sub, not_node_t *name, not_s
                 not_node_class_t *class2 = (not_node_class_t *)item1->value;
                 if (not_helper_id_cmp(class2->key, name) == 0)
                 {
+                    not_record_t *record = not_record_intern_find(item1);
+                    if (record)
+                    {
+                        return record;
+                    }
+
                     not_strip_t *strip_copy = not_strip_create(NULL);
                     if (strip_copy == NOT_PTR_ERROR)
                     {
                         return NOT_PTR_ERROR;
                     }
 
-                    return not_record_make_type(item1, strip_copy);
+                    return not_record_intern_push(item1, not_record_make_type(item1, strip_copy));
                 }
                 continue;
             }
@@ -507,13 +677,19 @@ not_primary_selection(not_node_t *base, not_node_t *sub, not_node_t *name, not_s
                 not_node_fun_t *fun1 = (not_node_fun_t *)item1->value;
                 if (not_helper_id_cmp(fun1->key, name) == 0)
                 {
+                    not_record_t *record = not_record_intern_find(item1);
+                    if (record)
+                    {
+                        return record;
+                    }
+
                     not_strip_t *strip_copy = not_strip_create(NULL);
                     if (strip_copy == NOT_PTR_ERROR)
                     {
                         return NOT_PTR_ERROR;
                     }
 
-                    return not_record_make_type(item1, strip_copy);
+                    return not_record_intern_push(item1, not_record_make_type(item1, strip_copy));
                 }
                 continue;
             }
@@ -693,13 +869,19 @@ not_primary_selection(not_node_t *base, not_node_t *sub, not_node_t *name, not_s
                         }
                     }
 
+                    not_record_t *record = not_record_intern_find(item1);
+                    if (record)
+                    {
+                        return record;
+                    }
+
                     not_strip_t *strip_copy = not_strip_create(NULL);
                     if (strip_copy == NOT_PTR_ERROR)
                     {
                         return NOT_PTR_ERROR;
                     }
 
-                    return not_record_make_type(item1, strip_copy);
+                    return not_record_intern_push(item1, not_record_make_type(item1, strip_copy));
                 }
 
                 continue;
@@ -814,6 +996,12 @@ not_primary_selection(not_node_t *base, not_node_t *sub, not_node_t *name, not_s
         return not_primary_selection(base->parent, base, name, strip, applicant);
     }
 
+    not_record_t *record_builtin = not_primary_builtin(name);
+    if (record_builtin != NULL)
+    {
+        return record_builtin;
+    }
+
     not_node_basic_t *basic1 = (not_node_basic_t *)name->value;
     not_error_type_by_node(name, "'%s' not defined", basic1->value);
     return NOT_PTR_ERROR;
@@ -884,6 +1072,49 @@ not_primary_number(not_node_t *node, not_strip_t *strip, not_node_t *applicant,
     return record;
 }
 
+/*
+ * An operand that is only read, never bound. A number literal is parsed
+ * once and its immortal record is shared by every evaluation of the node,
+ * and typeof yields the interned name. An operand a struct operator may
+ * receive goes through not_primary_right_operand instead.
+ */
+not_record_t *
+not_primary_operand(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
+{
+    if (node->kind == NODE_KIND_TYPEOF)
+    {
+        return not_prefix_typeof_operand(node, strip, applicant, origin);
+    }
+    else if (node->kind != NODE_KIND_NUMBER)
+    {
+        return not_expression(node, strip, applicant, origin);
+    }
+
+    not_record_t *record = not_record_intern_find(node);
+    if (record)
+    {
+        return record;
+    }
+
+    return not_record_intern_push(node, not_primary_number(node, strip, applicant, origin));
+}
+
+/*
+ * The right operand of a binary whose left is already evaluated. A struct
+ * on the left passes it to an operator fun that binds it to a parameter,
+ * so it is only read in place when the left is a plain value.
+ */
+not_record_t *
+not_primary_right_operand(not_node_t *node, not_record_t *left, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
+{
+    if (left->kind == RECORD_KIND_STRUCT)
+    {
+        return not_expression(node, strip, applicant, origin);
+    }
+
+    return not_primary_operand(node, strip, applicant, origin);
+}
+
 not_record_t *
 not_primary_char(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
@@ -921,25 +1152,49 @@ not_primary_nan(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not
 not_record_t *
 not_primary_kint(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
-    return not_record_make_type(node, NULL);
+    not_record_t *record = not_record_intern_find(node);
+    if (record)
+    {
+        return record;
+    }
+
+    return not_record_intern_push(node, not_record_make_type(node, NULL));
 }
 
 not_record_t *
 not_primary_kfloat(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
-    return not_record_make_type(node, NULL);
+    not_record_t *record = not_record_intern_find(node);
+    if (record)
+    {
+        return record;
+    }
+
+    return not_record_intern_push(node, not_record_make_type(node, NULL));
 }
 
 not_record_t *
 not_primary_kchar(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
-    return not_record_make_type(node, NULL);
+    not_record_t *record = not_record_intern_find(node);
+    if (record)
+    {
+        return record;
+    }
+
+    return not_record_intern_push(node, not_record_make_type(node, NULL));
 }
 
 not_record_t *
 not_primary_kstring(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
-    return not_record_make_type(node, NULL);
+    not_record_t *record = not_record_intern_find(node);
+    if (record)
+    {
+        return record;
+    }
+
+    return not_record_intern_push(node, not_record_make_type(node, NULL));
 }
 
 not_record_t *
@@ -974,6 +1229,17 @@ not_primary_this(not_node_t *node, not_strip_t *strip, not_node_t *applicant, no
 not_record_t *
 not_primary_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
+    /*
+     * A lambda captures nothing from the strip it is evaluated in, names in
+     * its body resolve through the caller at call time, so every evaluation
+     * of the same definition site yields the same value.
+     */
+    not_record_t *record = not_record_intern_find(node);
+    if (record)
+    {
+        return record;
+    }
+
     not_node_lambda_t *fun1 = (not_node_lambda_t *)node->value;
     if (fun1->body)
     {
@@ -983,11 +1249,11 @@ not_primary_lambda(not_node_t *node, not_strip_t *strip, not_node_t *applicant,
             return NOT_PTR_ERROR;
         }
 
-        return not_record_make_type(node, strip_copy);
+        return not_record_intern_push(node, not_record_make_type(node, strip_copy));
     }
     else
     {
-        return not_record_make_type(node, NULL);
+        return not_record_intern_push(node, not_record_make_type(node, NULL));
     }
 }
 
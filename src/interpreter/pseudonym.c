@@ -304,10 +304,181 @@ not_pseudonym_type_extends_of_type(not_node_t *node, not_record_t *record_type1,
     return 0;
 }
 
+#define NOT_PSEUDONYM_CACHE_SIZE 4
+#define NOT_PSEUDONYM_CACHE_ARGUMENTS 8
+
+/*
+ * Instantiations made at a PSEUDONYM node, keyed by the generic type and the
+ * types given as fields. Only types that carry no scope of their own are
+ * keyed, the instantiation then depends on nothing else and is shared; the
+ * records are kept for the life of the program.
+ */
+typedef struct not_pseudonym_cache
+{
+    size_t count;
+    struct
+    {
+        not_node_t *type;
+        uint64_t size;
+        not_node_t *arguments[NOT_PSEUDONYM_CACHE_ARGUMENTS];
+        not_record_t *record;
+    } entries[NOT_PSEUDONYM_CACHE_SIZE];
+} not_pseudonym_cache_t;
+
+static int32_t
+not_pseudonym_is_bare(not_record_t *record)
+{
+    if (record->kind != RECORD_KIND_TYPE)
+    {
+        return 0;
+    }
+
+    not_record_type_t *record_type = (not_record_type_t *)record->value;
+    not_strip_t *strip = (not_strip_t *)record_type->value;
+    if (strip == NULL)
+    {
+        return 1;
+    }
+
+    if ((strip->previous != NULL) || (strip->slots_count > 0))
+    {
+        return 0;
+    }
+
+    if ((strip->variables != NULL) && (strip->variables->begin != strip->variables->end))
+    {
+        return 0;
+    }
+
+    if ((strip->inputs != NULL) && (strip->inputs->begin != strip->inputs->end))
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+ * Evaluates the fields of the node into the type nodes they name, returns 0
+ * when some of them can not be part of a key.
+ */
+static int32_t
+not_pseudonym_arguments(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t **arguments, uint64_t *size)
+{
+    not_node_pseudonym_t *carrier = (not_node_pseudonym_t *)node->value;
+    not_node_block_t *block = (not_node_block_t *)carrier->data->value;
+
+    uint64_t count = 0;
+    for (not_node_t *item = block->items; item != NULL; item = item->next)
+    {
+        if (count >= NOT_PSEUDONYM_CACHE_ARGUMENTS)
+        {
+            return 0;
+        }
+
+        not_node_field_t *field = (not_node_field_t *)item->value;
+        not_record_t *record_field = not_expression(field->value ? field->value : field->key, strip, applicant, NULL);
+        if (record_field == NOT_PTR_ERROR)
+        {
+            return -1;
+        }
+
+        int32_t bare = not_pseudonym_is_bare(record_field);
+        if (bare)
+        {
+            arguments[count++] = ((not_record_type_t *)record_field->value)->type;
+        }
+
+        if (not_record_link_decrease(record_field) < 0)
+        {
+            return -1;
+        }
+
+        if (!bare)
+        {
+            return 0;
+        }
+    }
+
+    *size = count;
+    return 1;
+}
+
+static not_record_t *
+not_pseudonym_cache_find(not_node_t *node, not_node_t *type, not_node_t **arguments, uint64_t size)
+{
+    not_node_pseudonym_t *carrier = (not_node_pseudonym_t *)node->value;
+    not_pseudonym_cache_t *cache = (not_pseudonym_cache_t *)carrier->cache;
+    if (cache == NULL)
+    {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < cache->count; i++)
+    {
+        if ((cache->entries[i].type != type) || (cache->entries[i].size != size))
+        {
+            continue;
+        }
+
+        uint64_t j = 0;
+        for (; j < size; j++)
+        {
+            if (cache->entries[i].arguments[j] != arguments[j])
+            {
+                break;
+            }
+        }
+
+        if (j == size)
+        {
+            return cache->entries[i].record;
+        }
+    }
+
+    return NULL;
+}
+
+static int32_t
+not_pseudonym_cache_push(not_node_t *node, not_node_t *type, not_node_t **arguments, uint64_t size, not_record_t *record)
+{
+    not_node_pseudonym_t *carrier = (not_node_pseudonym_t *)node->value;
+    not_pseudonym_cache_t *cache = (not_pseudonym_cache_t *)carrier->cache;
+    if (cache == NULL)
+    {
+        cache = (not_pseudonym_cache_t *)not_memory_calloc(1, sizeof(not_pseudonym_cache_t));
+        if (cache == NULL)
+        {
+            not_error_no_memory();
+            return -1;
+        }
+        carrier->cache = cache;
+    }
+
+    if (cache->count < NOT_PSEUDONYM_CACHE_SIZE)
+    {
+        cache->entries[cache->count].type = type;
+        cache->entries[cache->count].size = size;
+        for (uint64_t j = 0; j < size; j++)
+        {
+            cache->entries[cache->count].arguments[j] = arguments[j];
+        }
+        cache->entries[cache->count].record = record;
+        cache->count += 1;
+
+        not_record_link_increase(record);
+    }
+
+    return 0;
+}
+
+static not_record_t *
+not_pseudonym_instantiate(not_node_t *node, not_record_t *base, not_strip_t *strip, not_node_t *applicant);
+
 not_record_t *
 not_pseudonym(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
-    not_node_carrier_t *carrier = (not_node_carrier_t *)node->value;
+    not_node_pseudonym_t *carrier = (not_node_pseudonym_t *)node->value;
 
     not_record_t *base = not_expression(carrier->base, strip, applicant, origin);
     if (base == NOT_PTR_ERROR)
@@ -315,6 +486,58 @@ not_pseudonym(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_n
         return NOT_PTR_ERROR;
     }
 
+    if (!not_pseudonym_is_bare(base))
+    {
+        return not_pseudonym_instantiate(node, base, strip, applicant);
+    }
+
+    not_node_t *arguments[NOT_PSEUDONYM_CACHE_ARGUMENTS];
+    uint64_t size = 0;
+    int32_t r1 = not_pseudonym_arguments(node, strip, applicant, arguments, &size);
+    if (r1 < 0)
+    {
+        not_record_link_decrease(base);
+        return NOT_PTR_ERROR;
+    }
+    else if (r1 == 0)
+    {
+        return not_pseudonym_instantiate(node, base, strip, applicant);
+    }
+
+    not_node_t *type = ((not_record_type_t *)base->value)->type;
+
+    not_record_t *result = not_pseudonym_cache_find(node, type, arguments, size);
+    if (result)
+    {
+        if (not_record_link_decrease(base) < 0)
+        {
+            return NOT_PTR_ERROR;
+        }
+
+        not_record_link_increase(result);
+        return result;
+    }
+
+    result = not_pseudonym_instantiate(node, base, strip, applicant);
+    if (result == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    if (not_pseudonym_cache_push(node, type, arguments, size, result) < 0)
+    {
+        not_record_link_decrease(result);
+        return NOT_PTR_ERROR;
+    }
+
+    return result;
+}
+
+static not_record_t *
+not_pseudonym_instantiate(not_node_t *node, not_record_t *base, not_strip_t *strip, not_node_t *applicant)
+{
+    not_node_pseudonym_t *carrier = (not_node_pseudonym_t *)node->value;
+
     if (base->kind != RECORD_KIND_TYPE)
     {
         goto region_error_nogen;
@@ -47,7 +47,9 @@ static const char *const symbols[] = {
     [RECORD_KIND_UNDEFINED] = "undefined",
     [RECORD_KIND_NAN] = "nan",
     [RECORD_KIND_PROC] = "proc",
-    [RECORD_KIND_BUILTIN] = "builtin"};
+    [RECORD_KIND_BUILTIN] = "builtin",
+    [RECORD_KIND_RANGE] = "instance range",
+    [RECORD_KIND_GENERATOR] = "instance generator"};
 
 const char *
 not_record_type_as_string(not_record_t *record)
@@ -70,19 +72,114 @@ not_record_create(uint64_t kind, void *value)
     record->link = 1;
     record->reference = 0;
     record->readonly = 0;
+    record->parent = NULL;
 
     return record;
 }
 
+not_record_t *
+not_record_make_view(uint64_t kind, void *value, not_record_t *parent)
+{
+    not_record_t *record = not_record_create(kind, value);
+    if (record == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    record->reference = 1;
+    record->parent = parent;
+    if (parent)
+    {
+        not_record_link_increase(parent);
+    }
+
+    return record;
+}
+
+not_record_t *
+not_record_view_owner(not_record_t *record)
+{
+    if (record->reference == 1)
+    {
+        return record->parent ? record->parent : record;
+    }
+
+    if (record->readonly == 1)
+    {
+        return record;
+    }
+
+    /*
+     * Assignment replaces the buffer of a record in place, so views never link
+     * the record itself. The buffer moves to a hidden owner that the record
+     * and its views share; the record materializes its own copy before it is
+     * written, while the views keep the owner alive.
+     */
+    not_record_t *owner = not_record_create(record->kind, record->value);
+    if (owner == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    record->reference = 1;
+    record->parent = owner;
+
+    return owner;
+}
+
+int32_t
+not_record_view_detach(not_record_t *record)
+{
+    not_record_t *parent = record->parent;
+
+    record->reference = 0;
+    record->parent = NULL;
+
+    if (parent)
+    {
+        if (not_record_link_decrease(parent) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+int32_t
+not_record_view_materialize(not_record_t *record)
+{
+    if (record->reference == 0)
+    {
+        return 0;
+    }
+
+    size_t size = (record->kind == RECORD_KIND_STRING) ? strlen((char *)record->value) + 1 : sizeof(char);
+    void *ptr = not_memory_calloc(1, size);
+    if (ptr == NULL)
+    {
+        not_error_no_memory();
+        return -1;
+    }
+    memcpy(ptr, record->value, size);
+
+    record->value = ptr;
+    return not_record_view_detach(record);
+}
+
 void not_record_link_increase(not_record_t *record)
 {
+    if (record->immortal)
+    {
+        return;
+    }
     record->link += 1;
 }
 
 int32_t
 not_record_link_decrease(not_record_t *record)
 {
-    if (!record)
+    if (!record || record->immortal)
     {
         return 0;
     }
@@ -98,6 +195,145 @@ not_record_link_decrease(not_record_t *record)
     return 0;
 }
 
+/*
+ * An immortal record is shared by everyone that evaluates it and never
+ * destroyed. It is readonly, a copy of it is an ordinary record, and its link
+ * never reads as a single holder.
+ */
+not_record_t *
+not_record_make_immortal(not_record_t *record)
+{
+    record->immortal = 1;
+    record->readonly = 1;
+    record->link = INT64_MAX;
+    return record;
+}
+
+/* immortal records interned by the node or constant they were made from */
+static struct
+{
+    uint64_t capacity;
+    uint64_t count;
+    void **keys;
+    not_record_t **values;
+} not_record_interned = {0, 0, NULL, NULL};
+
+static uint64_t
+not_record_intern_hash(void *key)
+{
+    uint64_t h = (uint64_t)(uintptr_t)key;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+}
+
+not_record_t *
+not_record_intern_find(void *key)
+{
+    if (not_record_interned.count == 0)
+    {
+        return NULL;
+    }
+
+    uint64_t mask = not_record_interned.capacity - 1;
+    for (uint64_t i = not_record_intern_hash(key) & mask;; i = (i + 1) & mask)
+    {
+        if (not_record_interned.keys[i] == key)
+        {
+            return not_record_interned.values[i];
+        }
+        else if (not_record_interned.keys[i] == NULL)
+        {
+            return NULL;
+        }
+    }
+}
+
+static int32_t
+not_record_intern_grow()
+{
+    uint64_t capacity = not_record_interned.capacity ? not_record_interned.capacity * 2 : 64;
+
+    void **keys = (void **)not_memory_calloc(capacity, sizeof(void *));
+    if (keys == NULL)
+    {
+        not_error_no_memory();
+        return -1;
+    }
+
+    not_record_t **values = (not_record_t **)not_memory_calloc(capacity, sizeof(not_record_t *));
+    if (values == NULL)
+    {
+        not_memory_free(keys);
+        not_error_no_memory();
+        return -1;
+    }
+
+    for (uint64_t j = 0; j < not_record_interned.capacity; j++)
+    {
+        if (not_record_interned.keys[j] == NULL)
+        {
+            continue;
+        }
+
+        uint64_t i = not_record_intern_hash(not_record_interned.keys[j]) & (capacity - 1);
+        while (keys[i] != NULL)
+        {
+            i = (i + 1) & (capacity - 1);
+        }
+        keys[i] = not_record_interned.keys[j];
+        values[i] = not_record_interned.values[j];
+    }
+
+    if (not_record_interned.keys)
+    {
+        not_memory_free(not_record_interned.keys);
+        not_memory_free(not_record_interned.values);
+    }
+
+    not_record_interned.keys = keys;
+    not_record_interned.values = values;
+    not_record_interned.capacity = capacity;
+
+    return 0;
+}
+
+/*
+ * Makes the record immortal and interns it by key. Takes the result of a
+ * not_record_make_* call, so an error is passed through.
+ */
+not_record_t *
+not_record_intern_push(void *key, not_record_t *record)
+{
+    if (record == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
+    if ((not_record_interned.count + 1) * 2 > not_record_interned.capacity)
+    {
+        if (not_record_intern_grow() < 0)
+        {
+            not_record_link_decrease(record);
+            return NOT_PTR_ERROR;
+        }
+    }
+
+    uint64_t mask = not_record_interned.capacity - 1;
+    uint64_t i = not_record_intern_hash(key) & mask;
+    while (not_record_interned.keys[i] != NULL)
+    {
+        i = (i + 1) & mask;
+    }
+
+    not_record_interned.keys[i] = key;
+    not_record_interned.values[i] = not_record_make_immortal(record);
+    not_record_interned.count += 1;
+
+    return record;
+}
+
 char *
 not_record_to_string(not_record_t *record, char *previous_buf)
 {
@@ -560,6 +796,22 @@ not_record_to_string(not_record_t *record, char *previous_buf)
         snprintf(result, length + 1, "%s%s", previous_buf, str);
         return result;
     }
+    else if (record->kind == RECORD_KIND_RANGE)
+    {
+        not_record_range_t *range = (not_record_range_t *)record->value;
+        char str[80];
+        snprintf(str, sizeof(str), "Range(%lld, %lld, %lld)",
+                 (long long)range->start, (long long)range->stop, (long long)range->step);
+        size_t length = strlen(previous_buf) + strlen(str);
+        char *result = not_memory_calloc(length + 1, sizeof(char));
+        if (result == NULL)
+        {
+            not_error_no_memory();
+            return NOT_PTR_ERROR;
+        }
+        snprintf(result, length + 1, "%s%s", previous_buf, str);
+        return result;
+    }
     else
     {
         char *str = "";
@@ -598,6 +850,30 @@ not_record_make_builtin(not_record_t *source, void *handle)
     return record;
 }
 
+not_record_t *
+not_record_make_range(int64_t start, int64_t stop, int64_t step)
+{
+    not_record_range_t *basic = (not_record_range_t *)not_memory_calloc(1, sizeof(not_record_range_t));
+    if (basic == NULL)
+    {
+        not_error_no_memory();
+        return NOT_PTR_ERROR;
+    }
+
+    basic->start = start;
+    basic->stop = stop;
+    basic->step = step;
+
+    not_record_t *record = not_record_create(RECORD_KIND_RANGE, basic);
+    if (record == NOT_PTR_ERROR)
+    {
+        not_memory_free(basic);
+        return NOT_PTR_ERROR;
+    }
+
+    return record;
+}
+
 not_record_t *
 not_record_make_proc(void *handle, json_t *map)
 {
@@ -904,6 +1180,29 @@ not_record_make_string(char *value)
     return record;
 }
 
+/*
+ * An interned record is shared and readonly, so a container that stores it
+ * gets a private copy in its place. The link on the interned record needs
+ * no release.
+ */
+int32_t
+not_record_unshare(not_record_t **record)
+{
+    if ((*record)->immortal == 0)
+    {
+        return 0;
+    }
+
+    not_record_t *record_copy = not_record_copy(*record);
+    if (record_copy == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    *record = record_copy;
+    return 0;
+}
+
 not_record_object_t *
 not_record_make_object(const char *key, not_record_t *value, not_record_object_t *next)
 {
@@ -924,6 +1223,13 @@ not_record_make_object(const char *key, not_record_t *value, not_record_object_t
     }
     strcpy(basic->key, key);
 
+    if (value && (not_record_unshare(&value) < 0))
+    {
+        not_memory_free(basic->key);
+        not_memory_free(basic);
+        return NOT_PTR_ERROR;
+    }
+
     basic->value = value;
     basic->next = next;
 
@@ -940,6 +1246,12 @@ not_record_make_tuple(not_record_t *value, not_record_tuple_t *next)
         return NOT_PTR_ERROR;
     }
 
+    if (value && (not_record_unshare(&value) < 0))
+    {
+        not_memory_free(basic);
+        return NOT_PTR_ERROR;
+    }
+
     basic->value = value;
     basic->next = next;
 
@@ -1431,7 +1743,10 @@ not_record_builtin_copy(not_record_builtin_t *builtin)
     builtin_copy->handle = builtin->handle;
     builtin_copy->source = builtin->source;
 
-    not_record_link_increase(builtin_copy->source);
+    if (builtin_copy->source)
+    {
+        not_record_link_increase(builtin_copy->source);
+    }
 
     return builtin_copy;
 }
@@ -1670,6 +1985,27 @@ not_record_copy(not_record_t *record)
 
         return record_copy;
     }
+    else if (record->kind == RECORD_KIND_GENERATOR)
+    {
+        /* a suspended frame cannot be duplicated, copies share the generator */
+        not_record_link_increase(record);
+        return record;
+    }
+    else if (record->kind == RECORD_KIND_RANGE)
+    {
+        not_record_range_t *range = (not_record_range_t *)record->value;
+        not_record_t *record_copy = not_record_make_range(range->start, range->stop, range->step);
+        if (record_copy == NOT_PTR_ERROR)
+        {
+            return NOT_PTR_ERROR;
+        }
+
+        record_copy->null = record->null;
+        record_copy->undefined = record->undefined;
+        record_copy->nan = record->nan;
+
+        return record_copy;
+    }
 
     return NULL;
 }
@@ -1729,6 +2065,15 @@ not_record_destroy(not_record_t *record)
         }
         not_memory_free(record);
     }
+    else if (record->kind == RECORD_KIND_GENERATOR)
+    {
+        not_record_generator_t *generator = (not_record_generator_t *)record->value;
+        if (not_generator_unlink(generator->type, generator) < 0)
+        {
+            return -1;
+        }
+        not_memory_free(record);
+    }
     else
     {
         if (record->kind == RECORD_KIND_INT)
@@ -1754,7 +2099,16 @@ not_record_destroy(not_record_t *record)
             not_memory_free(record->value);
         }
 
+        not_record_t *parent = record->parent;
         not_memory_free(record);
+
+        if (parent)
+        {
+            if (not_record_link_decrease(parent) < 0)
+            {
+                return -1;
+            }
+        }
     }
 
     return 0;
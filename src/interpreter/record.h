@@ -14,10 +14,12 @@ typedef struct not_record
     uint8_t undefined : 1;
     uint8_t nan : 1;
     uint8_t unpack : 1;
-    uint8_t reserved : 1;
+    uint8_t immortal : 1;
     int64_t link;
     uint8_t kind;
     void *value;
+    /* owner of the buffer a reference record points into, kept alive by link */
+    struct not_record *parent;
 } not_record_t;
 
 typedef enum not_record_kind
@@ -34,7 +36,9 @@ typedef enum not_record_kind
     RECORD_KIND_UNDEFINED,
     RECORD_KIND_NAN,
     RECORD_KIND_PROC,
-    RECORD_KIND_BUILTIN
+    RECORD_KIND_BUILTIN,
+    RECORD_KIND_RANGE,
+    RECORD_KIND_GENERATOR
 } not_record_kind_t;
 
 typedef struct not_record_struct
@@ -76,8 +80,35 @@ typedef struct not_record_builtin
     void *handle;
 } not_record_builtin_t;
 
+typedef struct not_record_range
+{
+    int64_t start;
+    int64_t stop;
+    int64_t step;
+} not_record_range_t;
+
+typedef struct not_record_generator
+{
+    not_node_t *type;
+    not_strip_t *value;
+    not_node_t *applicant;
+    /* suspended frame, owned by generator.c */
+    void *context;
+    /* records sharing the generator, the last one destroys it */
+    int64_t link;
+} not_record_generator_t;
+
 void not_record_link_increase(not_record_t *record);
 
+not_record_t *
+not_record_make_immortal(not_record_t *record);
+
+not_record_t *
+not_record_intern_find(void *key);
+
+not_record_t *
+not_record_intern_push(void *key, not_record_t *record);
+
 int32_t
 not_record_link_decrease(not_record_t *record);
 
@@ -90,6 +121,21 @@ not_record_create(uint64_t kind, void *value);
 not_record_t *
 not_record_copy(not_record_t *record);
 
+int32_t
+not_record_unshare(not_record_t **record);
+
+not_record_t *
+not_record_make_view(uint64_t kind, void *value, not_record_t *parent);
+
+not_record_t *
+not_record_view_owner(not_record_t *record);
+
+int32_t
+not_record_view_detach(not_record_t *record);
+
+int32_t
+not_record_view_materialize(not_record_t *record);
+
 not_record_t *
 not_record_make_null();
 
@@ -192,6 +238,9 @@ not_record_to_string(not_record_t *record, char *previous_buf);
 not_record_t *
 not_record_make_builtin(not_record_t *source, void *handle);
 
+not_record_t *
+not_record_make_range(int64_t start, int64_t stop, int64_t step);
+
 int32_t
 not_record_builtin_destroy(not_record_builtin_t *builtin);
 
@@ -940,6 +940,48 @@ not_relational_ge(not_node_t *node, not_record_t *left, not_record_t *right, not
     return not_record_make_int_from_si(0);
 }
 
+/*
+ * Compares same-kind numeric operands proven by the typing pass, NULL
+ * leaves flagged or mixed operands to the generic comparison.
+ */
+static not_record_t *
+not_relational_typed(not_node_t *node, not_record_t *left, not_record_t *right)
+{
+    if ((left->kind != right->kind) || left->null || left->undefined || left->nan || right->null || right->undefined || right->nan)
+    {
+        return NULL;
+    }
+
+    int32_t cmp = 0;
+    if (left->kind == RECORD_KIND_INT)
+    {
+        cmp = mpz_cmp((*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+    }
+    else if (left->kind == RECORD_KIND_FLOAT)
+    {
+        cmp = mpf_cmp((*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+    }
+    else
+    {
+        return NULL;
+    }
+
+    if (node->kind == NODE_KIND_LT)
+    {
+        return not_record_make_int_from_si(cmp < 0);
+    }
+    else if (node->kind == NODE_KIND_LE)
+    {
+        return not_record_make_int_from_si(cmp <= 0);
+    }
+    else if (node->kind == NODE_KIND_GT)
+    {
+        return not_record_make_int_from_si(cmp > 0);
+    }
+
+    return not_record_make_int_from_si(cmp >= 0);
+}
+
 not_record_t *
 not_relational(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_node_t *origin)
 {
@@ -959,7 +1001,16 @@ not_relational(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_
             return NOT_PTR_ERROR;
         }
 
-        not_record_t *record = not_relational_lt(node, left, right, applicant);
+        not_record_t *record = NULL;
+        if (binary->typed != NODE_TYPED_NONE)
+        {
+            record = not_relational_typed(node, left, right);
+        }
+
+        if (record == NULL)
+        {
+            record = not_relational_lt(node, left, right, applicant);
+        }
 
         if (not_record_link_decrease(left) < 0)
         {
@@ -989,7 +1040,16 @@ not_relational(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_
             return NOT_PTR_ERROR;
         }
 
-        not_record_t *record = not_relational_le(node, left, right, applicant);
+        not_record_t *record = NULL;
+        if (binary->typed != NODE_TYPED_NONE)
+        {
+            record = not_relational_typed(node, left, right);
+        }
+
+        if (record == NULL)
+        {
+            record = not_relational_le(node, left, right, applicant);
+        }
 
         if (not_record_link_decrease(left) < 0)
         {
@@ -1019,7 +1079,16 @@ not_relational(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_
             return NOT_PTR_ERROR;
         }
 
-        not_record_t *record = not_relational_gt(node, left, right, applicant);
+        not_record_t *record = NULL;
+        if (binary->typed != NODE_TYPED_NONE)
+        {
+            record = not_relational_typed(node, left, right);
+        }
+
+        if (record == NULL)
+        {
+            record = not_relational_gt(node, left, right, applicant);
+        }
 
         if (not_record_link_decrease(left) < 0)
         {
@@ -1049,7 +1118,16 @@ not_relational(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_
             return NOT_PTR_ERROR;
         }
 
-        not_record_t *record = not_relational_ge(node, left, right, applicant);
+        not_record_t *record = NULL;
+        if (binary->typed != NODE_TYPED_NONE)
+        {
+            record = not_relational_typed(node, left, right);
+        }
+
+        if (record == NULL)
+        {
+            record = not_relational_ge(node, left, right, applicant);
+        }
 
         if (not_record_link_decrease(left) < 0)
         {
@@ -1068,3 +1146,99 @@ not_relational(not_node_t *node, not_strip_t *strip, not_node_t *applicant, not_
         return not_shifting(node, strip, applicant, origin);
     }
 }
+
+/*
+ * A comparison that only decides a branch, answers 1 or 0 without boxing
+ * the result and reads a literal operand without parsing it, -1 on error.
+ */
+int32_t
+not_relational_branch(not_node_t *node, not_strip_t *strip, not_node_t *applicant)
+{
+    not_node_binary_t *binary = (not_node_binary_t *)node->value;
+    not_record_t *left = not_primary_operand(binary->left, strip, applicant, NULL);
+    if (left == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    not_record_t *right = not_primary_right_operand(binary->right, left, strip, applicant, NULL);
+    if (right == NOT_PTR_ERROR)
+    {
+        not_record_link_decrease(left);
+        return -1;
+    }
+
+    int32_t truthy = -1;
+    if ((left->kind == right->kind) && !left->null && !left->undefined && !left->nan && !right->null && !right->undefined && !right->nan &&
+        ((left->kind == RECORD_KIND_INT) || (left->kind == RECORD_KIND_FLOAT)))
+    {
+        int32_t cmp = 0;
+        if (left->kind == RECORD_KIND_INT)
+        {
+            cmp = mpz_cmp((*(mpz_t *)(left->value)), (*(mpz_t *)(right->value)));
+        }
+        else
+        {
+            cmp = mpf_cmp((*(mpf_t *)(left->value)), (*(mpf_t *)(right->value)));
+        }
+
+        if (node->kind == NODE_KIND_LT)
+        {
+            truthy = cmp < 0;
+        }
+        else if (node->kind == NODE_KIND_LE)
+        {
+            truthy = cmp <= 0;
+        }
+        else if (node->kind == NODE_KIND_GT)
+        {
+            truthy = cmp > 0;
+        }
+        else
+        {
+            truthy = cmp >= 0;
+        }
+    }
+    else
+    {
+        not_record_t *record = NULL;
+        if (node->kind == NODE_KIND_LT)
+        {
+            record = not_relational_lt(node, left, right, applicant);
+        }
+        else if (node->kind == NODE_KIND_LE)
+        {
+            record = not_relational_le(node, left, right, applicant);
+        }
+        else if (node->kind == NODE_KIND_GT)
+        {
+            record = not_relational_gt(node, left, right, applicant);
+        }
+        else
+        {
+            record = not_relational_ge(node, left, right, applicant);
+        }
+
+        if (record != NOT_PTR_ERROR)
+        {
+            truthy = not_execute_truthy(record);
+            if (not_record_link_decrease(record) < 0)
+            {
+                truthy = -1;
+            }
+        }
+    }
+
+    if (not_record_link_decrease(left) < 0)
+    {
+        not_record_link_decrease(right);
+        return -1;
+    }
+
+    if (not_record_link_decrease(right) < 0)
+    {
+        return -1;
+    }
+
+    return truthy;
+}
@@ -35,47 +35,87 @@
 #include "execute.h"
 
 not_strip_t *
-not_strip_create(not_strip_t *previous)
+not_strip_create_by_capacity(not_strip_t *previous, uint64_t capacity)
 {
-    not_strip_t *strip = (not_strip_t *)not_memory_calloc(1, sizeof(not_strip_t));
-    if (strip == NOT_PTR_ERROR)
+    not_strip_t *strip = (not_strip_t *)not_memory_calloc(1, sizeof(not_strip_t) + capacity * sizeof(not_entry_t));
+    if (strip == NULL)
     {
         not_error_no_memory();
         return NOT_PTR_ERROR;
     }
 
-    strip->inputs = not_queue_create();
-    if (strip->inputs == NOT_PTR_ERROR)
-    {
-        not_memory_free(strip);
-        return NOT_PTR_ERROR;
-    }
-
-    strip->variables = not_queue_create();
-    if (strip->variables == NOT_PTR_ERROR)
-    {
-        not_memory_free(strip);
-        not_queue_destroy(strip->inputs);
-        return NOT_PTR_ERROR;
-    }
+    strip->slots = (capacity > 0) ? (not_entry_t *)(strip + 1) : NULL;
+    strip->slots_count = 0;
+    strip->slots_capacity = capacity;
 
     strip->previous = previous;
 
     return strip;
 }
 
+not_strip_t *
+not_strip_create(not_strip_t *previous)
+{
+    return not_strip_create_by_capacity(previous, 0);
+}
+
+static not_queue_t *
+not_strip_queue(not_queue_t **queue)
+{
+    if (*queue == NULL)
+    {
+        not_queue_t *created = not_queue_create();
+        if (created == NOT_PTR_ERROR)
+        {
+            return NOT_PTR_ERROR;
+        }
+        *queue = created;
+    }
+
+    return *queue;
+}
+
 not_entry_t *
 not_strip_variable_push(not_strip_t *strip, not_node_t *scope, not_node_t *block, not_node_t *key, not_record_t *value)
 {
-    for (not_queue_entry_t *a1 = strip->variables->begin; a1 != strip->variables->end; a1 = a1->next)
+    for (uint64_t i = 0; i < strip->slots_count; i++)
     {
-        not_entry_t *item = (not_entry_t *)a1->value;
-        if ((item->scope->id == scope->id) && (not_helper_id_cmp(item->key, key) == 0))
+        not_entry_t *item = &strip->slots[i];
+        if (item->key && (item->scope->id == scope->id) && (not_helper_id_cmp(item->key, key) == 0))
         {
             return NULL;
         }
     }
 
+    if (strip->variables)
+    {
+        for (not_queue_entry_t *a1 = strip->variables->begin; a1 != strip->variables->end; a1 = a1->next)
+        {
+            not_entry_t *item = (not_entry_t *)a1->value;
+            if ((item->scope->id == scope->id) && (not_helper_id_cmp(item->key, key) == 0))
+            {
+                return NULL;
+            }
+        }
+    }
+
+    if (strip->slots_count < strip->slots_capacity)
+    {
+        not_entry_t *entry = &strip->slots[strip->slots_count++];
+
+        entry->scope = scope;
+        entry->key = key;
+        entry->value = value;
+        entry->block = block;
+
+        return entry;
+    }
+
+    if (not_strip_queue(&strip->variables) == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
     not_entry_t *entry = (not_entry_t *)not_memory_calloc(1, sizeof(not_entry_t));
     if (entry == NULL)
     {
@@ -100,10 +140,10 @@ not_strip_variable_push(not_strip_t *strip, not_node_t *scope, not_node_t *block
 not_entry_t *
 not_strip_variable_find(not_strip_t *strip, not_node_t *scope, not_node_t *key)
 {
-    for (not_queue_entry_t *a1 = strip->variables->begin; a1 != strip->variables->end; a1 = a1->next)
+    for (uint64_t i = 0; i < strip->slots_count; i++)
     {
-        not_entry_t *entry = (not_entry_t *)a1->value;
-        if ((entry->scope->id == scope->id) && not_helper_id_cmp(entry->key, key) == 0)
+        not_entry_t *entry = &strip->slots[i];
+        if (entry->key && (entry->scope->id == scope->id) && not_helper_id_cmp(entry->key, key) == 0)
         {
             if (entry->value)
             {
@@ -113,6 +153,22 @@ not_strip_variable_find(not_strip_t *strip, not_node_t *scope, not_node_t *key)
         }
     }
 
+    if (strip->variables)
+    {
+        for (not_queue_entry_t *a1 = strip->variables->begin; a1 != strip->variables->end; a1 = a1->next)
+        {
+            not_entry_t *entry = (not_entry_t *)a1->value;
+            if ((entry->scope->id == scope->id) && not_helper_id_cmp(entry->key, key) == 0)
+            {
+                if (entry->value)
+                {
+                    not_record_link_increase(entry->value);
+                }
+                return entry;
+            }
+        }
+    }
+
     if (strip->previous)
     {
         not_entry_t *entry = not_strip_variable_find(strip->previous, scope, key);
@@ -128,6 +184,11 @@ not_strip_variable_find(not_strip_t *strip, not_node_t *scope, not_node_t *key)
 not_entry_t *
 not_strip_input_find(not_strip_t *strip, not_node_t *scope, not_node_t *key)
 {
+    if (strip->inputs == NULL)
+    {
+        return NULL;
+    }
+
     for (not_queue_entry_t *a1 = strip->inputs->begin; a1 != strip->inputs->end; a1 = a1->next)
     {
         not_entry_t *entry = (not_entry_t *)a1->value;
@@ -147,6 +208,11 @@ not_strip_input_find(not_strip_t *strip, not_node_t *scope, not_node_t *key)
 not_entry_t *
 not_strip_input_push(not_strip_t *strip, not_node_t *scope, not_node_t *block, not_node_t *key, not_record_t *value)
 {
+    if (not_strip_queue(&strip->inputs) == NOT_PTR_ERROR)
+    {
+        return NOT_PTR_ERROR;
+    }
+
     for (not_queue_entry_t *a1 = strip->inputs->begin; a1 != strip->inputs->end; a1 = a1->next)
     {
         not_entry_t *item = (not_entry_t *)a1->value;
@@ -188,6 +254,31 @@ not_strip_variable_remove_by_scope(not_strip_t *strip, not_node_t *scope)
         }
     }
 
+    /* a slot cannot be unlinked, it is left empty and skipped from then on */
+    for (uint64_t i = 0; i < strip->slots_count; i++)
+    {
+        not_entry_t *entry = &strip->slots[i];
+        if (entry->key && (entry->scope->id == scope->id))
+        {
+            not_record_t *value = entry->value;
+
+            entry->scope = NULL;
+            entry->key = NULL;
+            entry->value = NULL;
+            entry->block = NULL;
+
+            if (not_record_link_decrease(value) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    if (strip->variables == NULL)
+    {
+        return 0;
+    }
+
     for (not_queue_entry_t *a = strip->variables->begin, *b = NULL; a != strip->variables->end; a = b)
     {
         b = a->next;
@@ -221,39 +312,58 @@ not_strip_destroy(not_strip_t *strip)
         strip->previous = NULL;
     }
 
-    for (not_queue_entry_t *a = strip->variables->begin, *b = NULL; a != strip->variables->end; a = b)
+    for (uint64_t i = 0; i < strip->slots_count; i++)
     {
-        b = a->next;
-        not_entry_t *item = (not_entry_t *)a->value;
+        not_entry_t *item = &strip->slots[i];
+        if (item->key)
+        {
+            if (not_record_link_decrease(item->value) < 0)
+            {
+                return -1;
+            }
+        }
+    }
 
-        if (not_record_link_decrease(item->value) < 0)
+    if (strip->variables)
+    {
+        for (not_queue_entry_t *a = strip->variables->begin, *b = NULL; a != strip->variables->end; a = b)
         {
-            return -1;
+            b = a->next;
+            not_entry_t *item = (not_entry_t *)a->value;
+
+            if (not_record_link_decrease(item->value) < 0)
+            {
+                return -1;
+            }
+
+            not_memory_free(item);
+            not_queue_unlink(strip->variables, a);
+            not_memory_free(a);
         }
 
-        not_memory_free(item);
-        not_queue_unlink(strip->variables, a);
-        not_memory_free(a);
+        not_queue_destroy(strip->variables);
     }
 
-    not_queue_destroy(strip->variables);
-
-    for (not_queue_entry_t *a = strip->inputs->begin, *b = NULL; a != strip->inputs->end; a = b)
+    if (strip->inputs)
     {
-        b = a->next;
-        not_entry_t *item = (not_entry_t *)a->value;
-
-        if (not_record_link_decrease(item->value) < 0)
+        for (not_queue_entry_t *a = strip->inputs->begin, *b = NULL; a != strip->inputs->end; a = b)
         {
-            return -1;
+            b = a->next;
+            not_entry_t *item = (not_entry_t *)a->value;
+
+            if (not_record_link_decrease(item->value) < 0)
+            {
+                return -1;
+            }
+
+            not_memory_free(item);
+            not_queue_unlink(strip->inputs, a);
+            not_memory_free(a);
         }
 
-        not_memory_free(item);
-        not_queue_unlink(strip->inputs, a);
-        not_memory_free(a);
+        not_queue_destroy(strip->inputs);
     }
 
-    not_queue_destroy(strip->inputs);
     not_memory_free(strip);
 
     return 0;
@@ -272,6 +382,18 @@ void not_strip_attach(not_strip_t *strip, not_strip_t *previous)
     }
 }
 
+void not_strip_detach(not_strip_t *strip, not_strip_t *previous)
+{
+    for (not_strip_t *strip_itr = strip; strip_itr != NULL; strip_itr = strip_itr->previous)
+    {
+        if (strip_itr->previous == previous)
+        {
+            strip_itr->previous = NULL;
+            break;
+        }
+    }
+}
+
 not_strip_t *
 not_strip_copy(not_strip_t *strip)
 {
@@ -285,7 +407,25 @@ not_strip_copy(not_strip_t *strip)
         }
     }
 
-    not_strip_t *strip_copy = not_strip_create(strip_previous);
+    /* the copy of a level is one allocation, its variables become slots */
+    uint64_t capacity = 0;
+    for (uint64_t i = 0; i < strip->slots_count; i++)
+    {
+        if (strip->slots[i].key)
+        {
+            capacity += 1;
+        }
+    }
+
+    if (strip->variables)
+    {
+        for (not_queue_entry_t *a = strip->variables->begin; a != strip->variables->end; a = a->next)
+        {
+            capacity += 1;
+        }
+    }
+
+    not_strip_t *strip_copy = not_strip_create_by_capacity(strip_previous, capacity);
     if (strip_copy == NOT_PTR_ERROR)
     {
         if (strip_previous)
@@ -299,30 +439,29 @@ not_strip_copy(not_strip_t *strip)
         return NOT_PTR_ERROR;
     }
 
-    for (not_queue_entry_t *a = strip->variables->begin; a != strip->variables->end; a = a->next)
+    for (uint64_t i = 0; i < strip->slots_count; i++)
     {
-        not_entry_t *item = (not_entry_t *)a->value;
-
-        not_entry_t *entry = (not_entry_t *)not_memory_calloc(1, sizeof(not_entry_t));
-        if (entry == NULL)
+        not_entry_t *item = &strip->slots[i];
+        if (item->key)
         {
-            not_error_no_memory();
-            not_strip_destroy(strip_copy);
-            return NOT_PTR_ERROR;
+            not_record_link_increase(item->value);
+            strip_copy->slots[strip_copy->slots_count++] = *item;
         }
+    }
 
-        not_record_link_increase(item->value);
+    if (strip->variables)
+    {
+        for (not_queue_entry_t *a = strip->variables->begin; a != strip->variables->end; a = a->next)
+        {
+            not_entry_t *item = (not_entry_t *)a->value;
 
-        entry->scope = item->scope;
-        entry->key = item->key;
-        entry->value = item->value;
-        entry->block = item->block;
+            not_record_link_increase(item->value);
 
-        if (NOT_PTR_ERROR == not_queue_right_push(strip_copy->variables, entry))
-        {
-            not_memory_free(entry);
-            not_strip_destroy(strip_copy);
-            return NOT_PTR_ERROR;
+            not_entry_t *entry = &strip_copy->slots[strip_copy->slots_count++];
+            entry->scope = item->scope;
+            entry->key = item->key;
+            entry->value = item->value;
+            entry->block = item->block;
         }
     }
 
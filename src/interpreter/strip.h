@@ -9,6 +9,10 @@ typedef struct not_strip /*Activation Records*/
     not_queue_t *variables;
     not_queue_t *inputs;
 
+    not_entry_t *slots;
+    uint64_t slots_count;
+    uint64_t slots_capacity;
+
     struct not_strip *previous;
     not_mutex_t lock;
 } not_strip_t;
@@ -16,6 +20,9 @@ typedef struct not_strip /*Activation Records*/
 not_strip_t *
 not_strip_create(not_strip_t *previous);
 
+not_strip_t *
+not_strip_create_by_capacity(not_strip_t *previous, uint64_t capacity);
+
 not_entry_t *
 not_strip_variable_push(not_strip_t *strip, not_node_t *scope, not_node_t *block, not_node_t *key, not_record_t *value);
 
@@ -33,6 +40,8 @@ not_strip_variable_remove_by_scope(not_strip_t *strip, not_node_t *scope);
 
 void not_strip_attach(not_strip_t *strip, not_strip_t *previous);
 
+void not_strip_detach(not_strip_t *strip, not_strip_t *previous);
+
 not_strip_t *not_strip_copy(not_strip_t *ar);
 
 int32_t
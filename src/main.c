@@ -61,13 +61,17 @@ int main(int argc, char **argv)
 				return -1;
 			}
 		}
+		else if (strcmp(argv[i], "--dump-types") == 0)
+		{
+			not_config_dump_types_set(1);
+		}
 	}
 
 	if (strcmp(not_config_get_input_file(), "") == 0)
 	{
 		fprintf(stderr,
 				"not-lang: fatal: no input file specified\n"
-				"using:not -f [file] ...\n");
+				"using:not -f [file] [--dump-types] ...\n");
 		return 0;
 	}
 
@@ -98,20 +102,14 @@ int main(int argc, char **argv)
 
 region_error:
 
-	not_thread_t *t = not_thread_get_current();
-
-	for (not_queue_entry_t *a = t->interpreter->expections->begin, *b = NULL; a != t->interpreter->expections->end; a = b)
+	not_record_t *expection = not_error_take();
+	if ((expection != NULL) && (expection != NOT_PTR_ERROR))
 	{
-		b = a->next;
-		not_record_t *expection = (not_record_t *)a->value;
-
 		char *str = not_record_to_string(expection, "");
 		printf("%s\n", str);
 		not_memory_free(str);
 
 		not_record_link_decrease(expection);
-		not_queue_unlink(t->interpreter->expections, a);
-		not_memory_free(a);
 	}
 
 	not_symbol_table_destroy();
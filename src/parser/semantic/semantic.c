@@ -380,7 +380,7 @@ not_semantic_array(not_node_t *node)
 static int32_t
 not_semantic_attribute(not_node_t *node)
 {
-    not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+    not_node_attribute_t *binary1 = (not_node_attribute_t *)node->value;
 
     int32_t r1 = not_semantic_expression(binary1->left);
     if (r1 == -1)
@@ -400,7 +400,7 @@ not_semantic_attribute(not_node_t *node)
 static int32_t
 not_semantic_pseudonym(not_node_t *node)
 {
-    not_node_carrier_t *carrier1 = (not_node_carrier_t *)node->value;
+    not_node_pseudonym_t *carrier1 = (not_node_pseudonym_t *)node->value;
 
     int32_t r1 = not_semantic_expression(carrier1->base);
     if (r1 == -1)
@@ -2674,10 +2674,13 @@ not_semantic_catch(not_node_t *node)
 {
     not_node_catch_t *catch1 = (not_node_catch_t *)node->value;
 
-    int32_t r1 = not_semantic_parameters(catch1->parameters);
-    if (r1 == -1)
+    if (catch1->parameters != NULL)
     {
-        return -1;
+        int32_t r1 = not_semantic_parameters(catch1->parameters);
+        if (r1 == -1)
+        {
+            return -1;
+        }
     }
 
     if (catch1->body != NULL)
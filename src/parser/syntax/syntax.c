@@ -75,6 +75,7 @@ not_syntax_save(not_syntax_t *syntax)
 
 	state->fun_depth = syntax->fun_depth;
 	state->loop_depth = syntax->loop_depth;
+	state->generator = syntax->generator;
 	state->offset = scanner->offset;
 	state->reading_offset = scanner->reading_offset;
 	state->line = scanner->line;
@@ -109,6 +110,7 @@ not_syntax_restore(not_syntax_t *syntax)
 
 	syntax->fun_depth = state->fun_depth;
 	syntax->loop_depth = state->loop_depth;
+	syntax->generator = state->generator;
 	scanner->offset = state->offset;
 	scanner->reading_offset = state->reading_offset;
 	scanner->line = state->line;
@@ -966,6 +968,8 @@ not_syntax_lambda(not_syntax_t *syntax, not_node_t *parent)
 	if ((syntax->token->type == TOKEN_LBRACE) || (key != NULL))
 	{
 		syntax->fun_depth += 1;
+		int32_t generator = syntax->generator;
+		syntax->generator = 0;
 
 		not_node_t *body = not_syntax_body(syntax, node);
 		if (body == NOT_PTR_ERROR)
@@ -975,7 +979,20 @@ not_syntax_lambda(not_syntax_t *syntax, not_node_t *parent)
 
 		syntax->fun_depth -= 1;
 
-		return not_node_make_lambda(node, key, generics, parameters, body, NULL);
+		node = not_node_make_lambda(node, key, generics, parameters, body, NULL);
+		if (node == NOT_PTR_ERROR)
+		{
+			return NOT_PTR_ERROR;
+		}
+
+		if (syntax->generator)
+		{
+			not_node_lambda_t *lambda1 = (not_node_lambda_t *)node->value;
+			lambda1->flag |= SYNTAX_MODIFIER_GENERATOR;
+		}
+		syntax->generator = generator;
+
+		return node;
 	}
 	else
 	{
@@ -3156,6 +3173,35 @@ not_syntax_return_stmt(not_syntax_t *syntax, not_node_t *parent)
 	return not_node_make_return(node, value);
 }
 
+static not_node_t *
+not_syntax_yield_stmt(not_syntax_t *syntax, not_node_t *parent)
+{
+	not_node_t *node = not_node_create(parent, syntax->token->position);
+	if (node == NOT_PTR_ERROR)
+	{
+		return NOT_PTR_ERROR;
+	}
+
+	if (not_syntax_match(syntax, TOKEN_YIELD_KEYWORD) == -1)
+	{
+		return NOT_PTR_ERROR;
+	}
+
+	syntax->generator = 1;
+
+	not_node_t *value = NULL;
+	if (syntax->token->type != TOKEN_SEMICOLON)
+	{
+		value = not_syntax_expression(syntax, node);
+		if (value == NOT_PTR_ERROR)
+		{
+			return NOT_PTR_ERROR;
+		}
+	}
+
+	return not_node_make_yield(node, value);
+}
+
 static not_node_t *
 not_syntax_reference_stmt(not_syntax_t *syntax, not_node_t *parent, uint64_t flag)
 {
@@ -3273,6 +3319,18 @@ not_syntax_statement(not_syntax_t *syntax, not_node_t *parent, uint64_t flag)
 			return NOT_PTR_ERROR;
 		}
 	}
+	else if ((syntax->token->type == TOKEN_YIELD_KEYWORD) && (syntax->fun_depth > 0))
+	{
+		node = not_syntax_yield_stmt(syntax, parent);
+		if (node == NOT_PTR_ERROR)
+		{
+			return NOT_PTR_ERROR;
+		}
+		if (not_syntax_match(syntax, TOKEN_SEMICOLON) == -1)
+		{
+			return NOT_PTR_ERROR;
+		}
+	}
 	else if (syntax->token->type == TOKEN_THROW_KEYWORD)
 	{
 		node = not_syntax_throw_stmt(syntax, parent);
@@ -3708,6 +3766,8 @@ not_syntax_class_fun(not_syntax_t *syntax, not_node_t *parent, not_node_t *note,
 	}
 
 	syntax->fun_depth += 1;
+	int32_t generator = syntax->generator;
+	syntax->generator = 0;
 
 	not_node_t *body = not_syntax_body(syntax, node);
 	if (body == NOT_PTR_ERROR)
@@ -3717,6 +3777,12 @@ not_syntax_class_fun(not_syntax_t *syntax, not_node_t *parent, not_node_t *note,
 
 	syntax->fun_depth -= 1;
 
+	if (syntax->generator)
+	{
+		flag |= SYNTAX_MODIFIER_GENERATOR;
+	}
+	syntax->generator = generator;
+
 	return not_node_make_func(node, note, flag, key, generics, parameters, result, body);
 }
 
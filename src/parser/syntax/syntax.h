@@ -10,7 +10,8 @@ typedef enum not_syntax_modifier
 	SYNTAX_MODIFIER_REFERENCE = 1 << 3,
 	SYNTAX_MODIFIER_KARG = 1 << 4,
 	SYNTAX_MODIFIER_KWARG = 1 << 5,
-	SYNTAX_MODIFIER_STATIC = 1 << 6
+	SYNTAX_MODIFIER_STATIC = 1 << 6,
+	SYNTAX_MODIFIER_GENERATOR = 1 << 7
 } not_syntax_modifier_t;
 
 typedef struct not_syntax
@@ -20,12 +21,14 @@ typedef struct not_syntax
 	not_token_t *token;
 	int32_t loop_depth;
 	int32_t fun_depth;
+	int32_t generator;
 } not_syntax_t;
 
 typedef struct not_syntax_state
 {
 	int32_t fun_depth;
 	int32_t loop_depth;
+	int32_t generator;
 	int32_t ch;
 	uint64_t offset;
 	uint64_t reading_offset;
@@ -0,0 +1,1835 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <assert.h>
+#include <jansson.h>
+#include <gmp.h>
+
+#include "../../types/types.h"
+#include "../../container/queue.h"
+#include "../../token/position.h"
+#include "../../token/token.h"
+#include "../../scanner/scanner.h"
+#include "../../ast/node.h"
+#include "../../utils/utils.h"
+#include "../../utils/path.h"
+#include "../syntax/syntax.h"
+#include "../../error.h"
+#include "../../mutex.h"
+#include "../../config.h"
+#include "../../repository.h"
+
+#include "typing.h"
+
+typedef enum not_typing_phase
+{
+    TYPING_PHASE_WRITES,
+    TYPING_PHASE_FOLD,
+    TYPING_PHASE_DECLARE,
+    TYPING_PHASE_VERIFY,
+    TYPING_PHASE_MARK,
+    TYPING_PHASE_DUMP
+} not_typing_phase_t;
+
+typedef struct not_typing
+{
+    int32_t phase;
+    int32_t changed;
+} not_typing_t;
+
+static int32_t
+not_typing_idcmp(not_node_t *n1, not_node_t *n2)
+{
+    not_node_basic_t *nb1 = (not_node_basic_t *)n1->value;
+    not_node_basic_t *nb2 = (not_node_basic_t *)n2->value;
+
+    return (strcmp(nb1->value, nb2->value) == 0);
+}
+
+static int32_t
+not_typing_expression(not_typing_t *typing, not_node_t *node);
+
+static int32_t
+not_typing_body(not_typing_t *typing, not_node_t *node);
+
+static int32_t
+not_typing_statement(not_typing_t *typing, not_node_t *node);
+
+static const char *
+not_typing_name(int32_t typed)
+{
+    if (typed == NODE_TYPED_INT)
+    {
+        return "int";
+    }
+    else if (typed == NODE_TYPED_FLOAT)
+    {
+        return "float";
+    }
+    else if (typed == NODE_TYPED_STRING)
+    {
+        return "string";
+    }
+
+    return "any";
+}
+
+static const char *
+not_typing_operator(int32_t kind)
+{
+    if (kind == NODE_KIND_PLUS)
+    {
+        return "+";
+    }
+    else if (kind == NODE_KIND_MINUS)
+    {
+        return "-";
+    }
+    else if (kind == NODE_KIND_MUL)
+    {
+        return "*";
+    }
+    else if (kind == NODE_KIND_DIV)
+    {
+        return "/";
+    }
+    else if (kind == NODE_KIND_MOD)
+    {
+        return "%";
+    }
+    else if (kind == NODE_KIND_LT)
+    {
+        return "<";
+    }
+    else if (kind == NODE_KIND_LE)
+    {
+        return "<=";
+    }
+    else if (kind == NODE_KIND_GT)
+    {
+        return ">";
+    }
+    else if (kind == NODE_KIND_GE)
+    {
+        return ">=";
+    }
+    else if (kind == NODE_KIND_EQ)
+    {
+        return "==";
+    }
+
+    return "!=";
+}
+
+static int32_t
+not_typing_typed_by_declaration(uint64_t flag, not_node_t *type)
+{
+    if ((flag & (SYNTAX_MODIFIER_REFERENCE | SYNTAX_MODIFIER_KARG | SYNTAX_MODIFIER_KWARG)) != 0)
+    {
+        return NODE_TYPED_NONE;
+    }
+
+    if (type == NULL)
+    {
+        return NODE_TYPED_NONE;
+    }
+    else if (type->kind == NODE_KIND_KINT)
+    {
+        return NODE_TYPED_INT;
+    }
+    else if (type->kind == NODE_KIND_KFLOAT)
+    {
+        return NODE_TYPED_FLOAT;
+    }
+    else if (type->kind == NODE_KIND_KSTRING)
+    {
+        return NODE_TYPED_STRING;
+    }
+
+    return NODE_TYPED_NONE;
+}
+
+static int32_t
+not_typing_declaration_by_parameters(not_node_t *node, not_node_t *parameters, not_node_t **declaration)
+{
+    if (parameters == NULL)
+    {
+        return 0;
+    }
+
+    not_node_block_t *block = (not_node_block_t *)parameters->value;
+    for (not_node_t *item1 = block->items; item1 != NULL; item1 = item1->next)
+    {
+        not_node_parameter_t *parameter1 = (not_node_parameter_t *)item1->value;
+        if (not_typing_idcmp(node, parameter1->key) == 1)
+        {
+            *declaration = item1;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static int32_t
+not_typing_declaration_by_var(not_node_t *node, not_node_t *item, not_node_t **declaration)
+{
+    if (item->kind != NODE_KIND_VAR)
+    {
+        return 0;
+    }
+
+    not_node_var_t *var1 = (not_node_var_t *)item->value;
+    if (var1->key->kind == NODE_KIND_ID)
+    {
+        if (not_typing_idcmp(node, var1->key) == 1)
+        {
+            *declaration = item;
+            return 1;
+        }
+        return 0;
+    }
+
+    not_node_block_t *block = (not_node_block_t *)var1->key->value;
+    for (not_node_t *item1 = block->items; item1 != NULL; item1 = item1->next)
+    {
+        not_node_entity_t *entity1 = (not_node_entity_t *)item1->value;
+        if (not_typing_idcmp(node, entity1->key) == 1)
+        {
+            *declaration = NULL;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Resolves an identifier to the var or parameter that declares it in the
+ * nearest enclosing scope, NULL when the binding is not a plain declaration.
+ */
+static not_node_t *
+not_typing_declaration(not_node_t *node)
+{
+    not_node_t *declaration = NULL;
+
+    for (not_node_t *node1 = node->parent, *subnode = node; node1 != NULL; subnode = node1, node1 = node1->parent)
+    {
+        if (node1->kind == NODE_KIND_BODY)
+        {
+            not_node_body_t *body1 = (not_node_body_t *)node1->value;
+            int32_t found = 0;
+
+            for (not_node_t *item1 = body1->declaration; item1 != NULL; item1 = item1->next)
+            {
+                if (item1->id == subnode->id)
+                {
+                    break;
+                }
+
+                if (not_typing_declaration_by_var(node, item1, &declaration) == 1)
+                {
+                    found = 1;
+                }
+            }
+
+            if (found == 1)
+            {
+                return declaration;
+            }
+        }
+        else if (node1->kind == NODE_KIND_FOR)
+        {
+            not_node_for_t *for1 = (not_node_for_t *)node1->value;
+
+            for (not_node_t *item1 = for1->initializer; item1 != NULL; item1 = item1->next)
+            {
+                if (not_typing_declaration_by_var(node, item1, &declaration) == 1)
+                {
+                    return declaration;
+                }
+            }
+        }
+        else if (node1->kind == NODE_KIND_FORIN)
+        {
+            not_node_forin_t *forin1 = (not_node_forin_t *)node1->value;
+
+            if ((forin1->field != NULL) && (not_typing_idcmp(node, forin1->field) == 1))
+            {
+                return NULL;
+            }
+
+            if ((forin1->value != NULL) && (not_typing_idcmp(node, forin1->value) == 1))
+            {
+                return NULL;
+            }
+        }
+        else if (node1->kind == NODE_KIND_CATCH)
+        {
+            not_node_catch_t *catch1 = (not_node_catch_t *)node1->value;
+
+            if (not_typing_declaration_by_parameters(node, catch1->parameters, &declaration) == 1)
+            {
+                return NULL;
+            }
+        }
+        else if (node1->kind == NODE_KIND_FUN)
+        {
+            not_node_fun_t *fun1 = (not_node_fun_t *)node1->value;
+
+            if (not_typing_declaration_by_parameters(node, fun1->parameters, &declaration) == 1)
+            {
+                return declaration;
+            }
+        }
+        else if (node1->kind == NODE_KIND_LAMBDA)
+        {
+            not_node_lambda_t *lambda1 = (not_node_lambda_t *)node1->value;
+
+            if (not_typing_declaration_by_parameters(node, lambda1->parameters, &declaration) == 1)
+            {
+                return declaration;
+            }
+        }
+        else if (node1->kind == NODE_KIND_CLASS)
+        {
+            return NULL;
+        }
+        else if (node1->kind == NODE_KIND_MODULE)
+        {
+            not_node_block_t *module1 = (not_node_block_t *)node1->value;
+
+            for (not_node_t *item1 = module1->items; item1 != NULL; item1 = item1->next)
+            {
+                if (not_typing_declaration_by_var(node, item1, &declaration) == 1)
+                {
+                    return declaration;
+                }
+            }
+
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+static int32_t
+not_typing_typed_by_id(not_node_t *node)
+{
+    not_node_t *declaration = not_typing_declaration(node);
+    if (declaration == NULL)
+    {
+        return NODE_TYPED_NONE;
+    }
+
+    if (declaration->kind == NODE_KIND_PARAMETER)
+    {
+        not_node_parameter_t *parameter1 = (not_node_parameter_t *)declaration->value;
+        return not_typing_typed_by_declaration(parameter1->flag, parameter1->type);
+    }
+
+    not_node_var_t *var1 = (not_node_var_t *)declaration->value;
+    if ((var1->flag & SYNTAX_MODIFIER_REFERENCE) == SYNTAX_MODIFIER_REFERENCE)
+    {
+        return NODE_TYPED_NONE;
+    }
+
+    return var1->typed;
+}
+
+static int32_t
+not_typing_typed_by_operator(int32_t kind, int32_t left, int32_t right)
+{
+    if (left != right)
+    {
+        return NODE_TYPED_NONE;
+    }
+
+    if ((left == NODE_TYPED_INT) || (left == NODE_TYPED_FLOAT))
+    {
+        return left;
+    }
+
+    if ((kind == NODE_KIND_PLUS) && (left == NODE_TYPED_STRING))
+    {
+        return left;
+    }
+
+    return NODE_TYPED_NONE;
+}
+
+/*
+ * The kind an expression is proven to produce under the current var
+ * assumptions, NODE_TYPED_NONE when nothing can be said statically.
+ */
+static int32_t
+not_typing_typed(not_node_t *node)
+{
+    if (node == NULL)
+    {
+        return NODE_TYPED_NONE;
+    }
+
+    if (node->kind == NODE_KIND_NUMBER)
+    {
+        not_node_basic_t *basic1 = (not_node_basic_t *)node->value;
+        return strchr(basic1->value, '.') ? NODE_TYPED_FLOAT : NODE_TYPED_INT;
+    }
+    else if (node->kind == NODE_KIND_STRING)
+    {
+        return NODE_TYPED_STRING;
+    }
+    else if (node->kind == NODE_KIND_ID)
+    {
+        return not_typing_typed_by_id(node);
+    }
+    else if (node->kind == NODE_KIND_PARENTHESIS)
+    {
+        not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+        return not_typing_typed(unary1->right);
+    }
+    else if ((node->kind == NODE_KIND_PLUS) || (node->kind == NODE_KIND_MINUS) || (node->kind == NODE_KIND_MUL) ||
+             (node->kind == NODE_KIND_DIV) || (node->kind == NODE_KIND_MOD))
+    {
+        not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+
+        int32_t left = not_typing_typed(binary1->left);
+        if (left == NODE_TYPED_NONE)
+        {
+            return NODE_TYPED_NONE;
+        }
+
+        return not_typing_typed_by_operator(node->kind, left, not_typing_typed(binary1->right));
+    }
+    else if ((node->kind == NODE_KIND_LT) || (node->kind == NODE_KIND_LE) || (node->kind == NODE_KIND_GT) ||
+             (node->kind == NODE_KIND_GE) || (node->kind == NODE_KIND_EQ) || (node->kind == NODE_KIND_NEQ))
+    {
+        return NODE_TYPED_INT;
+    }
+
+    return NODE_TYPED_NONE;
+}
+
+/*
+ * Marks a binary node whose operands are both proven int or both proven
+ * float, or a '+' over two proven strings, the evaluator then skips the
+ * generic type ladder for it.
+ */
+static void
+not_typing_typed_binary(not_node_t *node)
+{
+    not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+    binary1->typed = NODE_TYPED_NONE;
+
+    int32_t left = not_typing_typed(binary1->left);
+    if ((left != NODE_TYPED_INT) && (left != NODE_TYPED_FLOAT) && ((left != NODE_TYPED_STRING) || (node->kind != NODE_KIND_PLUS)))
+    {
+        return;
+    }
+
+    int32_t right = not_typing_typed(binary1->right);
+    if (left == right)
+    {
+        binary1->typed = left;
+    }
+}
+
+static void
+not_typing_demote(not_typing_t *typing, not_node_t *node)
+{
+    if (node->kind != NODE_KIND_ID)
+    {
+        return;
+    }
+
+    not_node_t *declaration = not_typing_declaration(node);
+    if ((declaration == NULL) || (declaration->kind != NODE_KIND_VAR))
+    {
+        return;
+    }
+
+    not_node_var_t *var1 = (not_node_var_t *)declaration->value;
+    if ((var1->type == NULL) && (var1->typed != NODE_TYPED_NONE))
+    {
+        var1->typed = NODE_TYPED_NONE;
+        typing->changed = 1;
+    }
+}
+
+/*
+ * An inferred var keeps its kind only while every assignment to it
+ * produces that same kind; declared vars are enforced at runtime instead.
+ */
+static void
+not_typing_assign(not_typing_t *typing, not_node_t *node)
+{
+    not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+
+    if (binary1->left->kind != NODE_KIND_ID)
+    {
+        if ((binary1->left->kind == NODE_KIND_TUPLE) || (binary1->left->kind == NODE_KIND_OBJECT))
+        {
+            not_node_block_t *block1 = (not_node_block_t *)binary1->left->value;
+            for (not_node_t *item = block1->items; item != NULL; item = item->next)
+            {
+                if (item->kind == NODE_KIND_PAIR)
+                {
+                    not_node_pair_t *pair1 = (not_node_pair_t *)item->value;
+                    not_typing_demote(typing, pair1->value);
+                }
+                else
+                {
+                    not_typing_demote(typing, item);
+                }
+            }
+        }
+        return;
+    }
+
+    not_node_t *declaration = not_typing_declaration(binary1->left);
+    if ((declaration == NULL) || (declaration->kind != NODE_KIND_VAR))
+    {
+        return;
+    }
+
+    not_node_var_t *var1 = (not_node_var_t *)declaration->value;
+    if ((var1->type != NULL) || (var1->typed == NODE_TYPED_NONE))
+    {
+        return;
+    }
+
+    int32_t right = not_typing_typed(binary1->right);
+    int32_t result = NODE_TYPED_NONE;
+
+    if (node->kind == NODE_KIND_ASSIGN)
+    {
+        result = right;
+    }
+    else if (node->kind == NODE_KIND_ADD_ASSIGN)
+    {
+        result = not_typing_typed_by_operator(NODE_KIND_PLUS, var1->typed, right);
+    }
+    else if ((node->kind == NODE_KIND_SUB_ASSIGN) || (node->kind == NODE_KIND_MUL_ASSIGN) ||
+             (node->kind == NODE_KIND_DIV_ASSIGN) || (node->kind == NODE_KIND_MOD_ASSIGN))
+    {
+        result = not_typing_typed_by_operator(NODE_KIND_MINUS, var1->typed, right);
+    }
+
+    if (result != var1->typed)
+    {
+        var1->typed = NODE_TYPED_NONE;
+        typing->changed = 1;
+    }
+}
+
+static void
+not_typing_var(not_typing_t *typing, not_node_t *node)
+{
+    not_node_var_t *var1 = (not_node_var_t *)node->value;
+
+    if (typing->phase == TYPING_PHASE_DECLARE)
+    {
+        if (var1->key->kind != NODE_KIND_ID)
+        {
+            var1->typed = NODE_TYPED_NONE;
+        }
+        else if (var1->type != NULL)
+        {
+            var1->typed = not_typing_typed_by_declaration(var1->flag, var1->type);
+        }
+        else if ((var1->flag & SYNTAX_MODIFIER_REFERENCE) == SYNTAX_MODIFIER_REFERENCE)
+        {
+            var1->typed = NODE_TYPED_NONE;
+        }
+        else
+        {
+            var1->typed = not_typing_typed(var1->value);
+        }
+    }
+    else if (typing->phase == TYPING_PHASE_VERIFY)
+    {
+        if ((var1->type == NULL) && (var1->typed != NODE_TYPED_NONE))
+        {
+            if (not_typing_typed(var1->value) != var1->typed)
+            {
+                var1->typed = NODE_TYPED_NONE;
+                typing->changed = 1;
+            }
+        }
+    }
+    else if (typing->phase == TYPING_PHASE_DUMP)
+    {
+        if (var1->key->kind == NODE_KIND_ID)
+        {
+            not_node_basic_t *basic1 = (not_node_basic_t *)var1->key->value;
+            fprintf(stdout, "%s:%lld:%lld: var %s: %s\n", node->position.path, (long long)node->position.line, (long long)node->position.column,
+                    basic1->value, not_typing_name(var1->typed));
+        }
+    }
+}
+
+/*
+ * Reads an int literal the way the evaluator does, 0 when the node is
+ * not a number or holds a float.
+ */
+static int32_t
+not_typing_integer(not_node_t *node, mpz_t value)
+{
+    if ((node == NULL) || (node->kind != NODE_KIND_NUMBER))
+    {
+        return 0;
+    }
+
+    not_node_basic_t *basic1 = (not_node_basic_t *)node->value;
+    char *str = basic1->value;
+
+    if (strchr(str, '.'))
+    {
+        return 0;
+    }
+
+    int32_t base = 10;
+
+    if (str[0] == '0')
+    {
+        if (str[1] == 'x' || str[1] == 'X')
+        {
+            base = 16;
+            str += 2;
+        }
+        else if (str[1] == 'b' || str[1] == 'B')
+        {
+            base = 2;
+            str += 2;
+        }
+        else if (isdigit(str[1]))
+        {
+            if (not_utils_is_octal_string(str))
+            {
+                base = 8;
+            }
+        }
+    }
+
+    if (mpz_set_str(value, str, base) < 0)
+    {
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+ * Whether target lies below node in a constant expression subtree, the
+ * parser hangs postfix and binary nodes off their left operand.
+ */
+static int32_t
+not_typing_contains(not_node_t *node, not_node_t *target)
+{
+    if ((node->kind == NODE_KIND_PARENTHESIS) || (node->kind == NODE_KIND_TILDE) || (node->kind == NODE_KIND_NEG) ||
+        (node->kind == NODE_KIND_POS))
+    {
+        not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+        return (unary1->right == target) || not_typing_contains(unary1->right, target);
+    }
+    else if ((node->kind == NODE_KIND_PLUS) || (node->kind == NODE_KIND_MINUS) || (node->kind == NODE_KIND_MUL) ||
+             (node->kind == NODE_KIND_DIV) || (node->kind == NODE_KIND_MOD) || (node->kind == NODE_KIND_SHL) ||
+             (node->kind == NODE_KIND_SHR) || (node->kind == NODE_KIND_AND) || (node->kind == NODE_KIND_XOR) ||
+             (node->kind == NODE_KIND_OR))
+    {
+        not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+        return (binary1->left == target) || (binary1->right == target) ||
+               not_typing_contains(binary1->left, target) || not_typing_contains(binary1->right, target);
+    }
+    else if (node->kind == NODE_KIND_ATTRIBUTE)
+    {
+        not_node_attribute_t *attribute1 = (not_node_attribute_t *)node->value;
+        return (attribute1->left == target) || (attribute1->right == target);
+    }
+
+    return 0;
+}
+
+/*
+ * A counted loop bound is built from int literals and at most
+ * NODE_FOR_COUNTED_NAMES names other than the counter under + - *.
+ */
+static int32_t
+not_typing_counted_bound(not_node_t *node, not_node_t *key, int32_t *names)
+{
+    if (node->kind == NODE_KIND_NUMBER)
+    {
+        not_node_basic_t *basic1 = (not_node_basic_t *)node->value;
+        return strchr(basic1->value, '.') == NULL;
+    }
+    else if (node->kind == NODE_KIND_ID)
+    {
+        if (not_typing_idcmp(node, key) == 1)
+        {
+            return 0;
+        }
+
+        *names += 1;
+        return *names <= NODE_FOR_COUNTED_NAMES;
+    }
+    else if (node->kind == NODE_KIND_PARENTHESIS)
+    {
+        not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+        return not_typing_counted_bound(unary1->right, key, names);
+    }
+    else if ((node->kind == NODE_KIND_PLUS) || (node->kind == NODE_KIND_MINUS) || (node->kind == NODE_KIND_MUL))
+    {
+        not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+        return not_typing_counted_bound(binary1->left, key, names) && not_typing_counted_bound(binary1->right, key, names);
+    }
+
+    return 0;
+}
+
+/*
+ * for (var i = ...; i < bound; i += literal) over a proven int var, the
+ * evaluator runs it on a native counter and rechecks every assumption.
+ */
+static void
+not_typing_counted(not_node_t *node)
+{
+    not_node_for_t *for1 = (not_node_for_t *)node->value;
+    for1->counted = 0;
+
+    not_node_t *initializer = for1->initializer;
+    if ((initializer == NULL) || (initializer->next != NULL) || (initializer->kind != NODE_KIND_VAR))
+    {
+        return;
+    }
+
+    not_node_var_t *var1 = (not_node_var_t *)initializer->value;
+    if ((var1->key->kind != NODE_KIND_ID) || (var1->value == NULL) || (var1->typed != NODE_TYPED_INT) ||
+        ((var1->flag & (SYNTAX_MODIFIER_READONLY | SYNTAX_MODIFIER_REFERENCE)) != 0))
+    {
+        return;
+    }
+
+    not_node_t *condition = for1->condition;
+    if ((condition == NULL) || ((condition->kind != NODE_KIND_LT) && (condition->kind != NODE_KIND_LE) &&
+                                (condition->kind != NODE_KIND_GT) && (condition->kind != NODE_KIND_GE)))
+    {
+        return;
+    }
+
+    not_node_binary_t *binary1 = (not_node_binary_t *)condition->value;
+    if ((binary1->left->kind != NODE_KIND_ID) || (not_typing_declaration(binary1->left) != initializer))
+    {
+        return;
+    }
+
+    int32_t names = 0;
+    if (!not_typing_counted_bound(binary1->right, var1->key, &names))
+    {
+        return;
+    }
+
+    not_node_t *incrementor = for1->incrementor;
+    if ((incrementor == NULL) || (incrementor->next != NULL) ||
+        ((incrementor->kind != NODE_KIND_ADD_ASSIGN) && (incrementor->kind != NODE_KIND_SUB_ASSIGN)))
+    {
+        return;
+    }
+
+    not_node_binary_t *binary2 = (not_node_binary_t *)incrementor->value;
+    if ((binary2->left->kind != NODE_KIND_ID) || (not_typing_declaration(binary2->left) != initializer))
+    {
+        return;
+    }
+
+    mpz_t step;
+    mpz_init(step);
+    if (not_typing_integer(binary2->right, step) && mpz_fits_slong_p(step))
+    {
+        for1->counted = 1;
+    }
+    mpz_clear(step);
+}
+
+/*
+ * Turns the node into a number literal in place, the subtree it held is
+ * released through a throwaway node and the parent link is moved above it.
+ */
+static int32_t
+not_typing_replace(not_typing_t *typing, not_node_t *node, char *value)
+{
+    not_node_t *parent = node->parent;
+    while ((parent != NULL) && not_typing_contains(node, parent))
+    {
+        parent = parent->parent;
+    }
+    node->parent = parent;
+
+    not_node_t *number = not_node_create(node->parent, node->position);
+    if (number == NOT_PTR_ERROR)
+    {
+        return -1;
+    }
+
+    if (not_node_make_number(number, value) == NOT_PTR_ERROR)
+    {
+        not_node_destroy(number);
+        return -1;
+    }
+
+    int32_t kind = node->kind;
+    void *value1 = node->value;
+
+    node->kind = number->kind;
+    node->value = number->value;
+
+    number->kind = kind;
+    number->value = value1;
+
+    not_node_destroy(number);
+
+    typing->changed = 1;
+    return 0;
+}
+
+static int32_t
+not_typing_fold_unary(not_typing_t *typing, not_node_t *node)
+{
+    not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+
+    mpz_t right, result;
+    mpz_init(right);
+    mpz_init(result);
+
+    if (not_typing_integer(unary1->right, right) == 0)
+    {
+        mpz_clear(right);
+        mpz_clear(result);
+        return 0;
+    }
+
+    if (node->kind == NODE_KIND_TILDE)
+    {
+        mpz_com(result, right);
+    }
+    else if (node->kind == NODE_KIND_NEG)
+    {
+        mpz_neg(result, right);
+    }
+    else
+    {
+        mpz_set(result, right);
+    }
+
+    char *str = mpz_get_str(NULL, 10, result);
+    mpz_clear(right);
+    mpz_clear(result);
+
+    int32_t r = not_typing_replace(typing, node, str);
+    free(str);
+    return r;
+}
+
+/*
+ * Folds int operands with the evaluator's own gmp calls, leaving alone
+ * anything that would raise at runtime or grow without bound.
+ */
+static int32_t
+not_typing_fold_binary(not_typing_t *typing, not_node_t *node)
+{
+    not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+
+    mpz_t left, right, result;
+    mpz_init(left);
+    mpz_init(right);
+    mpz_init(result);
+
+    if ((not_typing_integer(binary1->left, left) == 0) || (not_typing_integer(binary1->right, right) == 0))
+    {
+        mpz_clear(left);
+        mpz_clear(right);
+        mpz_clear(result);
+        return 0;
+    }
+
+    int32_t folded = 1;
+
+    if (node->kind == NODE_KIND_PLUS)
+    {
+        mpz_add(result, left, right);
+    }
+    else if (node->kind == NODE_KIND_MINUS)
+    {
+        mpz_sub(result, left, right);
+    }
+    else if (node->kind == NODE_KIND_MUL)
+    {
+        mpz_mul(result, left, right);
+    }
+    else if ((node->kind == NODE_KIND_DIV) && (mpz_sgn(right) != 0))
+    {
+        mpz_div(result, left, right);
+    }
+    else if ((node->kind == NODE_KIND_MOD) && (mpz_sgn(right) != 0))
+    {
+        mpz_mod(result, left, right);
+    }
+    else if (node->kind == NODE_KIND_AND)
+    {
+        mpz_and(result, left, right);
+    }
+    else if (node->kind == NODE_KIND_OR)
+    {
+        mpz_ior(result, left, right);
+    }
+    else if (node->kind == NODE_KIND_XOR)
+    {
+        mpz_xor(result, left, right);
+    }
+    else if ((node->kind == NODE_KIND_SHL) && (mpz_cmp_ui(right, 1024) <= 0) && (mpz_sgn(right) >= 0))
+    {
+        mpz_mul_2exp(result, left, mpz_get_ui(right));
+    }
+    else if ((node->kind == NODE_KIND_SHR) && (mpz_sgn(right) >= 0))
+    {
+        if (mpz_cmp_ui(right, mpz_sizeinbase(left, 2)) >= 0)
+        {
+            mpz_set_ui(result, 0);
+        }
+        else
+        {
+            mpz_fdiv_q_2exp(result, left, mpz_get_ui(right));
+        }
+    }
+    else
+    {
+        folded = 0;
+    }
+
+    if (folded == 0)
+    {
+        mpz_clear(left);
+        mpz_clear(right);
+        mpz_clear(result);
+        return 0;
+    }
+
+    char *str = mpz_get_str(NULL, 10, result);
+    mpz_clear(left);
+    mpz_clear(right);
+    mpz_clear(result);
+
+    int32_t r = not_typing_replace(typing, node, str);
+    free(str);
+    return r;
+}
+
+static int32_t
+not_typing_fold_parenthesis(not_typing_t *typing, not_node_t *node)
+{
+    not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+    if ((unary1->right == NULL) || (unary1->right->kind != NODE_KIND_NUMBER))
+    {
+        return 0;
+    }
+
+    not_node_basic_t *basic1 = (not_node_basic_t *)unary1->right->value;
+    return not_typing_replace(typing, node, basic1->value);
+}
+
+/*
+ * Resolves an identifier to the class it names, NULL as soon as a var,
+ * parameter, generic or import could bind the same name first.
+ */
+static not_node_t *
+not_typing_class_by_id(not_node_t *node)
+{
+    for (not_node_t *node1 = node->parent; node1 != NULL; node1 = node1->parent)
+    {
+        if (node1->kind == NODE_KIND_BODY)
+        {
+            not_node_body_t *body1 = (not_node_body_t *)node1->value;
+
+            for (not_node_t *item1 = body1->declaration; item1 != NULL; item1 = item1->next)
+            {
+                not_node_t *declaration = NULL;
+                if (not_typing_declaration_by_var(node, item1, &declaration) == 1)
+                {
+                    return NULL;
+                }
+
+                if (item1->kind == NODE_KIND_CLASS)
+                {
+                    not_node_class_t *class1 = (not_node_class_t *)item1->value;
+                    if (not_typing_idcmp(node, class1->key) == 1)
+                    {
+                        return NULL;
+                    }
+                }
+                else if (item1->kind == NODE_KIND_FUN)
+                {
+                    not_node_fun_t *fun1 = (not_node_fun_t *)item1->value;
+                    if (not_typing_idcmp(node, fun1->key) == 1)
+                    {
+                        return NULL;
+                    }
+                }
+            }
+        }
+        else if (node1->kind == NODE_KIND_FOR)
+        {
+            not_node_for_t *for1 = (not_node_for_t *)node1->value;
+
+            for (not_node_t *item1 = for1->initializer; item1 != NULL; item1 = item1->next)
+            {
+                not_node_t *declaration = NULL;
+                if (not_typing_declaration_by_var(node, item1, &declaration) == 1)
+                {
+                    return NULL;
+                }
+            }
+        }
+        else if (node1->kind == NODE_KIND_FORIN)
+        {
+            not_node_forin_t *forin1 = (not_node_forin_t *)node1->value;
+
+            if ((forin1->field != NULL) && (not_typing_idcmp(node, forin1->field) == 1))
+            {
+                return NULL;
+            }
+
+            if ((forin1->value != NULL) && (not_typing_idcmp(node, forin1->value) == 1))
+            {
+                return NULL;
+            }
+        }
+        else if (node1->kind == NODE_KIND_CATCH)
+        {
+            not_node_catch_t *catch1 = (not_node_catch_t *)node1->value;
+
+            not_node_t *declaration = NULL;
+            if (not_typing_declaration_by_parameters(node, catch1->parameters, &declaration) == 1)
+            {
+                return NULL;
+            }
+        }
+        else if (node1->kind == NODE_KIND_FUN)
+        {
+            not_node_fun_t *fun1 = (not_node_fun_t *)node1->value;
+
+            if (fun1->generics != NULL)
+            {
+                return NULL;
+            }
+
+            not_node_t *declaration = NULL;
+            if (not_typing_declaration_by_parameters(node, fun1->parameters, &declaration) == 1)
+            {
+                return NULL;
+            }
+        }
+        else if (node1->kind == NODE_KIND_LAMBDA)
+        {
+            not_node_lambda_t *lambda1 = (not_node_lambda_t *)node1->value;
+
+            if (lambda1->generics != NULL)
+            {
+                return NULL;
+            }
+
+            not_node_t *declaration = NULL;
+            if (not_typing_declaration_by_parameters(node, lambda1->parameters, &declaration) == 1)
+            {
+                return NULL;
+            }
+        }
+        else if (node1->kind == NODE_KIND_CLASS)
+        {
+            not_node_class_t *class1 = (not_node_class_t *)node1->value;
+
+            if (class1->generics != NULL)
+            {
+                return NULL;
+            }
+
+            for (not_node_t *item1 = class1->block; item1 != NULL; item1 = item1->next)
+            {
+                if (item1->kind == NODE_KIND_CLASS)
+                {
+                    not_node_class_t *class2 = (not_node_class_t *)item1->value;
+                    if (not_typing_idcmp(node, class2->key) == 1)
+                    {
+                        return item1;
+                    }
+                }
+                else if (item1->kind == NODE_KIND_FUN)
+                {
+                    not_node_fun_t *fun2 = (not_node_fun_t *)item1->value;
+                    if (not_typing_idcmp(node, fun2->key) == 1)
+                    {
+                        return NULL;
+                    }
+                }
+                else if (item1->kind == NODE_KIND_PROPERTY)
+                {
+                    not_node_property_t *property2 = (not_node_property_t *)item1->value;
+                    if (not_typing_idcmp(node, property2->key) == 1)
+                    {
+                        return NULL;
+                    }
+                }
+            }
+        }
+        else if (node1->kind == NODE_KIND_MODULE)
+        {
+            not_node_block_t *module1 = (not_node_block_t *)node1->value;
+
+            for (not_node_t *item1 = module1->items; item1 != NULL; item1 = item1->next)
+            {
+                if (item1->kind == NODE_KIND_USING)
+                {
+                    not_node_using_t *using1 = (not_node_using_t *)item1->value;
+                    if (using1->packages == NULL)
+                    {
+                        return NULL;
+                    }
+
+                    not_node_block_t *block2 = (not_node_block_t *)using1->packages->value;
+                    for (not_node_t *item2 = block2->items; item2 != NULL; item2 = item2->next)
+                    {
+                        not_node_package_t *package1 = (not_node_package_t *)item2->value;
+                        if (not_typing_idcmp(node, package1->key) == 1)
+                        {
+                            return NULL;
+                        }
+                    }
+                }
+                else if (item1->kind == NODE_KIND_CLASS)
+                {
+                    not_node_class_t *class1 = (not_node_class_t *)item1->value;
+                    if (not_typing_idcmp(node, class1->key) == 1)
+                    {
+                        return item1;
+                    }
+                }
+                else if (item1->kind == NODE_KIND_FUN)
+                {
+                    not_node_fun_t *fun1 = (not_node_fun_t *)item1->value;
+                    if (not_typing_idcmp(node, fun1->key) == 1)
+                    {
+                        return NULL;
+                    }
+                }
+                else
+                {
+                    not_node_t *declaration = NULL;
+                    if (not_typing_declaration_by_var(node, item1, &declaration) == 1)
+                    {
+                        return NULL;
+                    }
+                }
+            }
+
+            return NULL;
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Marks the property that Class.NAME names as written. A tuple or object
+ * target marks each of its items.
+ */
+static void
+not_typing_written(not_node_t *node)
+{
+    while (node->kind == NODE_KIND_PARENTHESIS)
+    {
+        not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+        node = unary1->right;
+    }
+
+    if ((node->kind == NODE_KIND_TUPLE) || (node->kind == NODE_KIND_OBJECT))
+    {
+        not_node_block_t *block1 = (not_node_block_t *)node->value;
+        for (not_node_t *item = block1->items; item != NULL; item = item->next)
+        {
+            if (item->kind == NODE_KIND_PAIR)
+            {
+                not_node_pair_t *pair1 = (not_node_pair_t *)item->value;
+                not_typing_written(pair1->value);
+            }
+            else
+            {
+                not_typing_written(item);
+            }
+        }
+        return;
+    }
+
+    if (node->kind != NODE_KIND_ATTRIBUTE)
+    {
+        return;
+    }
+
+    not_node_attribute_t *attribute1 = (not_node_attribute_t *)node->value;
+    if ((attribute1->left->kind != NODE_KIND_ID) || (attribute1->right->kind != NODE_KIND_ID))
+    {
+        return;
+    }
+
+    not_node_t *class = not_typing_class_by_id(attribute1->left);
+    if (class == NULL)
+    {
+        return;
+    }
+
+    not_node_class_t *class1 = (not_node_class_t *)class->value;
+    for (not_node_t *item1 = class1->block; item1 != NULL; item1 = item1->next)
+    {
+        if (item1->kind != NODE_KIND_PROPERTY)
+        {
+            continue;
+        }
+
+        not_node_property_t *property1 = (not_node_property_t *)item1->value;
+        if (not_typing_idcmp(attribute1->right, property1->key) == 1)
+        {
+            property1->written = 1;
+            return;
+        }
+    }
+}
+
+/*
+ * Replaces Class.NAME by the literal of an exported static readonly property
+ * whose initializer is a number and that nothing in the module writes.
+ * Inside the class only properties declared earlier are initialized, so
+ * later ones are left to the runtime.
+ */
+static int32_t
+not_typing_fold_attribute(not_typing_t *typing, not_node_t *node)
+{
+    not_node_attribute_t *attribute1 = (not_node_attribute_t *)node->value;
+    if ((attribute1->left->kind != NODE_KIND_ID) || (attribute1->right->kind != NODE_KIND_ID))
+    {
+        return 0;
+    }
+
+    not_node_t *class = not_typing_class_by_id(attribute1->left);
+    if (class == NULL)
+    {
+        return 0;
+    }
+
+    not_node_class_t *class1 = (not_node_class_t *)class->value;
+
+    not_node_t *member = NULL;
+    for (not_node_t *node1 = node; node1 != NULL; node1 = node1->parent)
+    {
+        if (node1->parent == class)
+        {
+            member = node1;
+            break;
+        }
+    }
+
+    for (not_node_t *item1 = class1->block; item1 != NULL; item1 = item1->next)
+    {
+        if ((member != NULL) && (member->kind == NODE_KIND_PROPERTY) && (item1->id == member->id))
+        {
+            return 0;
+        }
+
+        if (item1->kind != NODE_KIND_PROPERTY)
+        {
+            continue;
+        }
+
+        not_node_property_t *property1 = (not_node_property_t *)item1->value;
+        if (not_typing_idcmp(attribute1->right, property1->key) == 0)
+        {
+            continue;
+        }
+
+        uint64_t flag = SYNTAX_MODIFIER_EXPORT | SYNTAX_MODIFIER_STATIC | SYNTAX_MODIFIER_READONLY;
+        if (((property1->flag & flag) != flag) || (property1->type != NULL))
+        {
+            return 0;
+        }
+
+        if ((property1->value == NULL) || (property1->value->kind != NODE_KIND_NUMBER) || (property1->written == 1))
+        {
+            return 0;
+        }
+
+        not_node_basic_t *basic1 = (not_node_basic_t *)property1->value->value;
+        return not_typing_replace(typing, node, basic1->value);
+    }
+
+    return 0;
+}
+
+static int32_t
+not_typing_arguments(not_typing_t *typing, not_node_t *node)
+{
+    if (node == NULL)
+    {
+        return 0;
+    }
+
+    not_node_block_t *block = (not_node_block_t *)node->value;
+    for (not_node_t *item = block->items; item != NULL; item = item->next)
+    {
+        not_node_argument_t *argument1 = (not_node_argument_t *)item->value;
+        not_node_t *value = (argument1->value != NULL) ? argument1->value : argument1->key;
+        if ((typing->phase == TYPING_PHASE_WRITES) && (value != NULL))
+        {
+            /* the callee is not resolved, any parameter may be a reference */
+            not_typing_written(value);
+        }
+
+        if (argument1->value != NULL)
+        {
+            if (not_typing_expression(typing, argument1->value) < 0)
+            {
+                return -1;
+            }
+        }
+        else if (argument1->key != NULL)
+        {
+            if (not_typing_expression(typing, argument1->key) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int32_t
+not_typing_parameters(not_typing_t *typing, not_node_t *node)
+{
+    if (node == NULL)
+    {
+        return 0;
+    }
+
+    not_node_block_t *block = (not_node_block_t *)node->value;
+    for (not_node_t *item = block->items; item != NULL; item = item->next)
+    {
+        not_node_parameter_t *parameter1 = (not_node_parameter_t *)item->value;
+        if (parameter1->value != NULL)
+        {
+            if (not_typing_expression(typing, parameter1->value) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int32_t
+not_typing_expression(not_typing_t *typing, not_node_t *node)
+{
+    if (node == NULL)
+    {
+        return 0;
+    }
+
+    if ((node->kind == NODE_KIND_TYPEOF) || (node->kind == NODE_KIND_SIZEOF) || (node->kind == NODE_KIND_PARENTHESIS) ||
+        (node->kind == NODE_KIND_TILDE) || (node->kind == NODE_KIND_NOT) || (node->kind == NODE_KIND_NEG) ||
+        (node->kind == NODE_KIND_POS) || (node->kind == NODE_KIND_YIELD))
+    {
+        not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+        if (not_typing_expression(typing, unary1->right) < 0)
+        {
+            return -1;
+        }
+
+        if (typing->phase == TYPING_PHASE_FOLD)
+        {
+            if (node->kind == NODE_KIND_PARENTHESIS)
+            {
+                return not_typing_fold_parenthesis(typing, node);
+            }
+            else if ((node->kind == NODE_KIND_TILDE) || (node->kind == NODE_KIND_NEG) || (node->kind == NODE_KIND_POS))
+            {
+                return not_typing_fold_unary(typing, node);
+            }
+        }
+
+        return 0;
+    }
+    else if ((node->kind == NODE_KIND_POW) || (node->kind == NODE_KIND_EPI) || (node->kind == NODE_KIND_SHL) ||
+             (node->kind == NODE_KIND_SHR) || (node->kind == NODE_KIND_AND) || (node->kind == NODE_KIND_XOR) ||
+             (node->kind == NODE_KIND_OR) || (node->kind == NODE_KIND_LAND) || (node->kind == NODE_KIND_LOR) ||
+             (node->kind == NODE_KIND_INSTANCEOF))
+    {
+        not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+        if (not_typing_expression(typing, binary1->left) < 0)
+        {
+            return -1;
+        }
+
+        if (not_typing_expression(typing, binary1->right) < 0)
+        {
+            return -1;
+        }
+
+        if ((typing->phase == TYPING_PHASE_FOLD) && ((node->kind == NODE_KIND_SHL) || (node->kind == NODE_KIND_SHR) ||
+                                                     (node->kind == NODE_KIND_AND) || (node->kind == NODE_KIND_XOR) ||
+                                                     (node->kind == NODE_KIND_OR)))
+        {
+            return not_typing_fold_binary(typing, node);
+        }
+
+        return 0;
+    }
+    else if ((node->kind == NODE_KIND_ASSIGN) || (node->kind == NODE_KIND_ADD_ASSIGN) || (node->kind == NODE_KIND_SUB_ASSIGN) ||
+             (node->kind == NODE_KIND_MUL_ASSIGN) || (node->kind == NODE_KIND_DIV_ASSIGN) || (node->kind == NODE_KIND_EPI_ASSIGN) ||
+             (node->kind == NODE_KIND_MOD_ASSIGN) || (node->kind == NODE_KIND_POW_ASSIGN) || (node->kind == NODE_KIND_AND_ASSIGN) ||
+             (node->kind == NODE_KIND_OR_ASSIGN) || (node->kind == NODE_KIND_SHL_ASSIGN) || (node->kind == NODE_KIND_SHR_ASSIGN))
+    {
+        not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+        if (typing->phase == TYPING_PHASE_WRITES)
+        {
+            not_typing_written(binary1->left);
+        }
+
+        /* the target itself is never folded, only what it is read through */
+        if (binary1->left->kind == NODE_KIND_ATTRIBUTE)
+        {
+            not_node_attribute_t *attribute1 = (not_node_attribute_t *)binary1->left->value;
+            if (not_typing_expression(typing, attribute1->left) < 0)
+            {
+                return -1;
+            }
+        }
+        else if (not_typing_expression(typing, binary1->left) < 0)
+        {
+            return -1;
+        }
+
+        if (not_typing_expression(typing, binary1->right) < 0)
+        {
+            return -1;
+        }
+
+        if (typing->phase == TYPING_PHASE_VERIFY)
+        {
+            not_typing_assign(typing, node);
+        }
+
+        return 0;
+    }
+    else if ((node->kind == NODE_KIND_MUL) || (node->kind == NODE_KIND_DIV) || (node->kind == NODE_KIND_MOD) ||
+             (node->kind == NODE_KIND_PLUS) || (node->kind == NODE_KIND_MINUS) || (node->kind == NODE_KIND_LT) ||
+             (node->kind == NODE_KIND_LE) || (node->kind == NODE_KIND_GT) || (node->kind == NODE_KIND_GE) ||
+             (node->kind == NODE_KIND_EQ) || (node->kind == NODE_KIND_NEQ))
+    {
+        not_node_binary_t *binary1 = (not_node_binary_t *)node->value;
+        if (not_typing_expression(typing, binary1->left) < 0)
+        {
+            return -1;
+        }
+
+        if (not_typing_expression(typing, binary1->right) < 0)
+        {
+            return -1;
+        }
+
+        if (typing->phase == TYPING_PHASE_FOLD)
+        {
+            if ((node->kind == NODE_KIND_PLUS) || (node->kind == NODE_KIND_MINUS) || (node->kind == NODE_KIND_MUL) ||
+                (node->kind == NODE_KIND_DIV) || (node->kind == NODE_KIND_MOD))
+            {
+                return not_typing_fold_binary(typing, node);
+            }
+        }
+        else if (typing->phase == TYPING_PHASE_MARK)
+        {
+            not_typing_typed_binary(node);
+        }
+        else if ((typing->phase == TYPING_PHASE_DUMP) && (binary1->typed != NODE_TYPED_NONE))
+        {
+            fprintf(stdout, "%s:%lld:%lld: operator '%s': %s\n", node->position.path, (long long)node->position.line, (long long)node->position.column,
+                    not_typing_operator(node->kind), not_typing_name(binary1->typed));
+        }
+
+        return 0;
+    }
+    else if (node->kind == NODE_KIND_CONDITIONAL)
+    {
+        not_node_triple_t *triple1 = (not_node_triple_t *)node->value;
+        if (not_typing_expression(typing, triple1->base) < 0)
+        {
+            return -1;
+        }
+
+        if (not_typing_expression(typing, triple1->left) < 0)
+        {
+            return -1;
+        }
+
+        return not_typing_expression(typing, triple1->right);
+    }
+    else if ((node->kind == NODE_KIND_CALL) || (node->kind == NODE_KIND_ARRAY))
+    {
+        not_node_carrier_t *carrier1 = (not_node_carrier_t *)node->value;
+        if (not_typing_expression(typing, carrier1->base) < 0)
+        {
+            return -1;
+        }
+
+        return not_typing_arguments(typing, carrier1->data);
+    }
+    else if (node->kind == NODE_KIND_ATTRIBUTE)
+    {
+        not_node_attribute_t *attribute1 = (not_node_attribute_t *)node->value;
+        if (not_typing_expression(typing, attribute1->left) < 0)
+        {
+            return -1;
+        }
+
+        if (typing->phase == TYPING_PHASE_FOLD)
+        {
+            return not_typing_fold_attribute(typing, node);
+        }
+
+        return 0;
+    }
+    else if (node->kind == NODE_KIND_TUPLE)
+    {
+        not_node_block_t *block1 = (not_node_block_t *)node->value;
+        for (not_node_t *item = block1->items; item != NULL; item = item->next)
+        {
+            if (not_typing_expression(typing, item) < 0)
+            {
+                return -1;
+            }
+        }
+
+        return 0;
+    }
+    else if (node->kind == NODE_KIND_OBJECT)
+    {
+        not_node_block_t *block1 = (not_node_block_t *)node->value;
+        for (not_node_t *item = block1->items; item != NULL; item = item->next)
+        {
+            not_node_pair_t *pair1 = (not_node_pair_t *)item->value;
+            if (not_typing_expression(typing, pair1->value) < 0)
+            {
+                return -1;
+            }
+        }
+
+        return 0;
+    }
+    else if (node->kind == NODE_KIND_LAMBDA)
+    {
+        not_node_lambda_t *lambda1 = (not_node_lambda_t *)node->value;
+        if (not_typing_parameters(typing, lambda1->parameters) < 0)
+        {
+            return -1;
+        }
+
+        if ((lambda1->body != NULL) && (lambda1->body->kind == NODE_KIND_BODY))
+        {
+            return not_typing_body(typing, lambda1->body);
+        }
+
+        return not_typing_expression(typing, lambda1->body);
+    }
+
+    return 0;
+}
+
+static int32_t
+not_typing_fun(not_typing_t *typing, not_node_t *node)
+{
+    not_node_fun_t *fun1 = (not_node_fun_t *)node->value;
+
+    if (not_typing_parameters(typing, fun1->parameters) < 0)
+    {
+        return -1;
+    }
+
+    return not_typing_body(typing, fun1->body);
+}
+
+static int32_t
+not_typing_class(not_typing_t *typing, not_node_t *node)
+{
+    not_node_class_t *class1 = (not_node_class_t *)node->value;
+
+    for (not_node_t *item = class1->block; item != NULL; item = item->next)
+    {
+        if (item->kind == NODE_KIND_FUN)
+        {
+            if (not_typing_fun(typing, item) < 0)
+            {
+                return -1;
+            }
+        }
+        else if (item->kind == NODE_KIND_PROPERTY)
+        {
+            not_node_property_t *property1 = (not_node_property_t *)item->value;
+            if (not_typing_expression(typing, property1->value) < 0)
+            {
+                return -1;
+            }
+        }
+        else if (item->kind == NODE_KIND_CLASS)
+        {
+            if (not_typing_class(typing, item) < 0)
+            {
+                return -1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static int32_t
+not_typing_statement(not_typing_t *typing, not_node_t *node)
+{
+    if (node->kind == NODE_KIND_IF)
+    {
+        not_node_if_t *if1 = (not_node_if_t *)node->value;
+
+        if (not_typing_expression(typing, if1->condition) < 0)
+        {
+            return -1;
+        }
+
+        if (not_typing_body(typing, if1->then_body) < 0)
+        {
+            return -1;
+        }
+
+        if (if1->else_body != NULL)
+        {
+            if (if1->else_body->kind == NODE_KIND_IF)
+            {
+                return not_typing_statement(typing, if1->else_body);
+            }
+            return not_typing_body(typing, if1->else_body);
+        }
+
+        return 0;
+    }
+    else if (node->kind == NODE_KIND_FOR)
+    {
+        not_node_for_t *for1 = (not_node_for_t *)node->value;
+
+        for (not_node_t *item = for1->initializer; item != NULL; item = item->next)
+        {
+            if (not_typing_statement(typing, item) < 0)
+            {
+                return -1;
+            }
+        }
+
+        if (typing->phase == TYPING_PHASE_MARK)
+        {
+            not_typing_counted(node);
+        }
+        else if ((typing->phase == TYPING_PHASE_DUMP) && (for1->counted == 1))
+        {
+            fprintf(stdout, "%s:%lld:%lld: for: counted\n", node->position.path, (long long)node->position.line, (long long)node->position.column);
+        }
+
+        if (not_typing_expression(typing, for1->condition) < 0)
+        {
+            return -1;
+        }
+
+        for (not_node_t *item = for1->incrementor; item != NULL; item = item->next)
+        {
+            if (not_typing_expression(typing, item) < 0)
+            {
+                return -1;
+            }
+        }
+
+        return not_typing_body(typing, for1->body);
+    }
+    else if (node->kind == NODE_KIND_FORIN)
+    {
+        not_node_forin_t *forin1 = (not_node_forin_t *)node->value;
+
+        if (not_typing_expression(typing, forin1->iterator) < 0)
+        {
+            return -1;
+        }
+
+        return not_typing_body(typing, forin1->body);
+    }
+    else if (node->kind == NODE_KIND_TRY)
+    {
+        not_node_try_t *try1 = (not_node_try_t *)node->value;
+
+        if (not_typing_body(typing, try1->body) < 0)
+        {
+            return -1;
+        }
+
+        for (not_node_t *item = try1->catchs; item != NULL;)
+        {
+            not_node_catch_t *catch1 = (not_node_catch_t *)item->value;
+            if (not_typing_body(typing, catch1->body) < 0)
+            {
+                return -1;
+            }
+            item = catch1->next;
+        }
+
+        return 0;
+    }
+    else if (node->kind == NODE_KIND_VAR)
+    {
+        not_node_var_t *var1 = (not_node_var_t *)node->value;
+        if (not_typing_expression(typing, var1->value) < 0)
+        {
+            return -1;
+        }
+
+        not_typing_var(typing, node);
+        return 0;
+    }
+    else if ((node->kind == NODE_KIND_RETURN) || (node->kind == NODE_KIND_THROW))
+    {
+        not_node_unary_t *unary1 = (not_node_unary_t *)node->value;
+        return not_typing_expression(typing, unary1->right);
+    }
+    else if ((node->kind == NODE_KIND_BREAK) || (node->kind == NODE_KIND_CONTINUE))
+    {
+        return 0;
+    }
+    else if (node->kind == NODE_KIND_FUN)
+    {
+        return not_typing_fun(typing, node);
+    }
+    else if (node->kind == NODE_KIND_CLASS)
+    {
+        return not_typing_class(typing, node);
+    }
+    else if (node->kind == NODE_KIND_USING)
+    {
+        return 0;
+    }
+
+    return not_typing_expression(typing, node);
+}
+
+static int32_t
+not_typing_body(not_typing_t *typing, not_node_t *node)
+{
+    if (node == NULL)
+    {
+        return 0;
+    }
+
+    not_node_body_t *body1 = (not_node_body_t *)node->value;
+    for (not_node_t *item = body1->declaration; item != NULL; item = item->next)
+    {
+        if (not_typing_statement(typing, item) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int32_t
+not_typing_items(not_typing_t *typing, not_node_t *node)
+{
+    not_node_block_t *module = (not_node_block_t *)node->value;
+
+    for (not_node_t *item = module->items; item != NULL; item = item->next)
+    {
+        if (not_typing_statement(typing, item) < 0)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Runs after the semantic checks. Static readonly properties that the module
+ * writes are marked first. Int constant expressions and reads of the other
+ * static readonly number properties are folded next, until nothing changes.
+ * Vars take the kind of their initializer
+ * or declared type, assignments that disagree demote them until nothing
+ * changes, then arithmetic and comparison nodes over proven int or float
+ * operands are marked for the evaluator's guarded fast paths.
+ */
+int32_t
+not_typing_module(not_node_t *node)
+{
+    not_typing_t typing;
+    typing.phase = TYPING_PHASE_WRITES;
+    typing.changed = 0;
+    if (not_typing_items(&typing, node) < 0)
+    {
+        return -1;
+    }
+
+    typing.phase = TYPING_PHASE_FOLD;
+    do
+    {
+        typing.changed = 0;
+        if (not_typing_items(&typing, node) < 0)
+        {
+            return -1;
+        }
+    } while (typing.changed == 1);
+
+    typing.phase = TYPING_PHASE_DECLARE;
+    typing.changed = 0;
+
+    if (not_typing_items(&typing, node) < 0)
+    {
+        return -1;
+    }
+
+    typing.phase = TYPING_PHASE_VERIFY;
+    do
+    {
+        typing.changed = 0;
+        if (not_typing_items(&typing, node) < 0)
+        {
+            return -1;
+        }
+    } while (typing.changed == 1);
+
+    typing.phase = TYPING_PHASE_MARK;
+    if (not_typing_items(&typing, node) < 0)
+    {
+        return -1;
+    }
+
+    if (not_config_dump_types_is_enable())
+    {
+        typing.phase = TYPING_PHASE_DUMP;
+        if (not_typing_items(&typing, node) < 0)
+        {
+            return -1;
+        }
+
+        fflush(stdout);
+    }
+
+    return 0;
+}
@@ -0,0 +1,8 @@
+#pragma once
+#ifndef __TYPING_H__
+#define __TYPING_H__
+
+int32_t
+not_typing_module(not_node_t *node);
+
+#endif
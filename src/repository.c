@@ -21,6 +21,7 @@
 #include "ast/node.h"
 #include "parser/syntax/syntax.h"
 #include "parser/semantic/semantic.h"
+#include "parser/typing/typing.h"
 #include "error.h"
 #include "mutex.h"
 #include "config.h"
@@ -227,6 +228,11 @@ region_normal_module:
         return NOT_PTR_ERROR;
     }
 
+    if (not_typing_module(entry->root) < 0)
+    {
+        return NOT_PTR_ERROR;
+    }
+
     if (not_execute_run(entry->root) < 0)
     {
         return NOT_PTR_ERROR;
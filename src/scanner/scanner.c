@@ -2308,6 +2308,20 @@ not_scanner_advance(not_scanner_t *scanner)
 
 				return 1;
 			}
+			else if (strncmp(scanner->source + start_offset, "yield", max(length, 5)) == 0)
+			{
+				not_scanner_set_token(scanner, (not_token_t){
+												   .type = TOKEN_YIELD_KEYWORD,
+												   .value = NULL,
+												   .position = {
+													   .path = scanner->path,
+													   .offset = scanner->offset - length,
+													   .column = scanner->column - length,
+													   .line = scanner->line,
+													   .length = length}});
+
+				return 1;
+			}
 			else if (strncmp(scanner->source + start_offset, "sizeof", max(length, 6)) == 0)
 			{
 				not_scanner_set_token(scanner, (not_token_t){
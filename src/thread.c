@@ -3,6 +3,8 @@
 #include <stdlib.h>
 #include <stdarg.h>
 #include <assert.h>
+#include <gmp.h>
+#include <jansson.h>
 
 #include "types/types.h"
 #include "utils/path.h"
@@ -13,9 +15,16 @@
 #include "memory.h"
 #include "interpreter.h"
 #include "thread.h"
+#include "ast/node.h"
+#include "interpreter/record.h"
+#include "interpreter/strip.h"
+#include "interpreter/execute.h"
 
 not_thread_t base_thread;
 
+/* set once by each thread on entry, spares the search through childrens */
+static _Thread_local not_thread_t *current_thread = NULL;
+
 int32_t
 not_thread_init()
 {
@@ -43,6 +52,8 @@ not_thread_init()
         return -1;
     }
 
+    current_thread = bt;
+
     return 0;
 }
 
@@ -51,6 +62,7 @@ void not_thread_destroy()
     not_thread_t *thread = not_thread_get();
     not_queue_destroy(thread->childrens);
     not_interpreter_destroy(thread->interpreter);
+    not_addative_release();
 }
 
 not_thread_t *
@@ -59,6 +71,28 @@ not_thread_get()
     return &base_thread;
 }
 
+#if defined(_WIN32) || defined(_WIN64)
+static DWORD WINAPI
+not_thread_start(LPVOID arg)
+{
+    not_thread_t *t = (not_thread_t *)arg;
+    current_thread = t;
+    DWORD result = t->start_routine(t->arg);
+    not_addative_release();
+    return result;
+}
+#else
+static void *
+not_thread_start(void *arg)
+{
+    not_thread_t *t = (not_thread_t *)arg;
+    current_thread = t;
+    void *result = t->start_routine(t->arg);
+    not_addative_release();
+    return result;
+}
+#endif
+
 not_thread_t *
 not_thread_create(
 #if defined(_WIN32) || defined(_WIN64)
@@ -105,9 +139,13 @@ not_thread_create(
         return NOT_PTR_ERROR;
     }
 
+    t->parent = parent;
+    t->start_routine = start_routine;
+    t->arg = arg;
+
 #if defined(_WIN32) || defined(_WIN64)
     DWORD threadId;
-    HANDLE thread = CreateThread(NULL, 0, start_routine, arg, 0, &threadId);
+    HANDLE thread = CreateThread(NULL, 0, not_thread_start, t, 0, &threadId);
     if (!thread)
     {
         not_interpreter_destroy(t->interpreter);
@@ -120,7 +158,7 @@ not_thread_create(
     t->thread = thread;
 #else
     pthread_t thread;
-    if (pthread_create(&thread, NULL, start_routine, arg) != 0)
+    if (pthread_create(&thread, NULL, not_thread_start, t) != 0)
     {
         not_interpreter_destroy(t->interpreter);
         not_memory_free(t);
@@ -159,6 +197,11 @@ not_thread_find_by_id(not_thread_t *parent, not_thread_id_t id)
 not_thread_t *
 not_thread_get_current()
 {
+    if (current_thread != NULL)
+    {
+        return current_thread;
+    }
+
 #if defined(_WIN32) || defined(_WIN64)
     DWORD id = GetCurrentThreadId();
 #else
@@ -169,18 +212,26 @@ not_thread_get_current()
 
     if (bt->id == id)
     {
+        current_thread = bt;
         return bt;
     }
 
     not_thread_t *r1 = not_thread_find_by_id(bt, id);
     if (r1 != NULL)
     {
+        current_thread = r1;
         return r1;
     }
 
     return NULL;
 }
 
+not_interpreter_t *
+not_thread_get_interpreter()
+{
+    return not_thread_get_current()->interpreter;
+}
+
 int32_t
 not_thread_join(not_thread_t *thread)
 {
@@ -267,6 +318,8 @@ not_thread_exit()
     not_interpreter_destroy(thread->interpreter);
     not_memory_free(thread);
 
+    current_thread = NULL;
+
 #if defined(_WIN32) || defined(_WIN64)
     ExitThread(0);
 #else
@@ -283,28 +336,3 @@ void not_thread_sleep(uint64_t ms)
     usleep(ms * 1000);
 #endif
 }
-
-not_record_t *
-not_thread_get_rax()
-{
-    not_thread_t *thread = not_thread_get_current();
-    not_record_t *value = thread->interpreter->rax;
-    return value;
-}
-
-void not_thread_set_rax(not_record_t *value)
-{
-    not_thread_t *thread = not_thread_get_current();
-    thread->interpreter->rax = value;
-}
-
-not_record_t *
-not_thread_get_and_set_rax(not_record_t *value)
-{
-    not_thread_t *thread = not_thread_get_current();
-
-    not_record_t *result = thread->interpreter->rax;
-    thread->interpreter->rax = value;
-
-    return result;
-}
@@ -20,8 +20,12 @@ typedef struct not_thread
 #if defined(_WIN32) || defined(_WIN64)
     DWORD id;
     HANDLE thread;
+    DWORD (*start_routine)(LPVOID);
+    LPVOID arg;
 #else
     pthread_t id;
+    void *(*start_routine)(void *);
+    void *arg;
 #endif
 } not_thread_t;
 
@@ -45,6 +49,9 @@ not_thread_create(
 not_thread_t *
 not_thread_get_current();
 
+not_interpreter_t *
+not_thread_get_interpreter();
+
 int32_t
 not_thread_join(not_thread_t *thread);
 
@@ -54,14 +61,6 @@ not_thread_join_all_childrens();
 int32_t
 not_thread_exit();
 
-void not_thread_set_rax(not_record_t *value);
-
-not_record_t *
-not_thread_get_rax();
-
-not_record_t *
-not_thread_get_and_set_rax(not_record_t *value);
-
 void not_thread_sleep(uint64_t ms);
 
 #endif
\ No newline at end of file
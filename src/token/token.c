@@ -91,6 +91,7 @@ const char *const symbols[] = {
     [TOKEN_CATCH_KEYWORD] = "catch keyword",
     [TOKEN_THROW_KEYWORD] = "throw keyword",
     [TOKEN_RETURN_KEYWORD] = "return keyword",
+    [TOKEN_YIELD_KEYWORD] = "yield keyword",
     [TOKEN_FOR_KEYWORD] = "for keyword",
     [TOKEN_SIZEOF_KEYWORD] = "sizeof keyword",
     [TOKEN_TYPEOF_KEYWORD] = "typeof keyword",
@@ -97,6 +97,7 @@ enum
   TOKEN_CATCH_KEYWORD,
   TOKEN_THROW_KEYWORD,
   TOKEN_RETURN_KEYWORD,
+  TOKEN_YIELD_KEYWORD,
   TOKEN_FOR_KEYWORD,
   TOKEN_SIZEOF_KEYWORD,
   TOKEN_TYPEOF_KEYWORD,